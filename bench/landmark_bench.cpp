@@ -0,0 +1,143 @@
+/**
+ * @file landmark_bench.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Expanded cells and latency of Dijkstra, octile A* and ALT A* on seeded maze and open maps
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../planner/landmark_table.hpp"
+#include "../planner/start_search.hpp"
+
+#define BENCH_QUERIES 200
+#define BENCH_SEED 550
+
+/**
+ * @brief Perfect maze carved by a randomized depth-first walk over the odd cells, corridors 1 cell wide
+ */
+static void generate_maze(GridMap &map, std::uint32_t side, std::mt19937 &random_engine)
+{
+    map.resize(side, side);
+    map.fill(BLOCK_OBSTACLE);
+    std::vector<std::uint32_t> stack = {map.index(1, 1)};
+    map.at(1, 1) = BLOCK_EMPTY;
+    const int dy[4] = {0, 2, 0, -2}, dx[4] = {2, 0, -2, 0};
+    while (!stack.empty())
+    {
+        std::int64_t y = stack.back() / map.get_stride(), x = stack.back() % map.get_stride();
+        std::uint32_t options[4], option_count = 0;
+        for (std::uint8_t dir = 0; dir < 4; dir++)
+            if (y + dy[dir] > 0 && x + dx[dir] > 0 && y + dy[dir] < side - 1 && x + dx[dir] < side - 1 &&
+                map.at(y + dy[dir], x + dx[dir]) == BLOCK_OBSTACLE)
+                options[option_count++] = dir;
+        if (option_count == 0)
+        {
+            stack.pop_back();
+            continue;
+        }
+        std::uint8_t dir = options[random_engine() % option_count];
+        map.at(y + dy[dir] / 2, x + dx[dir] / 2) = BLOCK_EMPTY;
+        map.at(y + dy[dir], x + dx[dir]) = BLOCK_EMPTY;
+        stack.push_back(map.index(y + dy[dir], x + dx[dir]));
+    }
+    map.mark_modified();
+}
+
+/**
+ * @brief Single-cell obstacles at the given density
+ */
+static void generate_scatter(GridMap &map, std::uint32_t side, std::uint32_t percentage, std::mt19937 &random_engine)
+{
+    map.resize(side, side);
+    for (std::uint32_t y = 0; y < side; y++)
+        for (std::uint32_t x = 0; x < side; x++)
+            map.at(y, x) = (random_engine() % 100 < percentage) ? BLOCK_OBSTACLE : BLOCK_EMPTY;
+    map.mark_modified();
+}
+
+/**
+ * @brief Run the same reachable queries with every mode and print mean expansions and latency
+ */
+static void run_map(const std::string &name, const GridMap &map, std::uint32_t landmark_count, std::mt19937 &random_engine)
+{
+    LandmarkTable table(8);
+    auto build_begin = std::chrono::steady_clock::now();
+    table.build(map, landmark_count);
+    double build_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - build_begin).count();
+
+    StartSearch plan_path(map);
+    plan_path.set_landmark_table(&table);
+    std::vector<std::uint32_t> free_cells;
+    for (std::uint32_t y = 0; y < map.get_height(); y++)
+        for (std::uint32_t x = 0; x < map.get_width(); x++)
+            if (map.at(y, x) != BLOCK_OBSTACLE)
+                free_cells.push_back(map.index(y, x));
+
+    const char *labels[3] = {"Dijkstra", "A* octile", "A* landmarks"};
+    double expanded[3] = {0, 0, 0}, latency[3] = {0, 0, 0};
+    std::uint32_t queries = 0, mismatches = 0;
+    while (queries < BENCH_QUERIES)
+    {
+        std::uint32_t from = free_cells[random_engine() % free_cells.size()];
+        std::uint32_t to = free_cells[random_engine() % free_cells.size()];
+        plan_path.set_endpoints(from / map.get_stride() + 1, from % map.get_stride() + 1, to / map.get_stride() + 1, to % map.get_stride() + 1);
+
+        double cost[3];
+        bool reached = true;
+        for (std::uint8_t mode = 0; mode < 3 && reached; mode++)
+        {
+            AStarConfig astar_config;
+            astar_config.heuristic = (mode == 1) ? HEURISTIC_OCTILE : HEURISTIC_LANDMARKS;
+            plan_path.set_astar_config(astar_config);
+            auto begin = std::chrono::steady_clock::now();
+            reached = plan_path.initiate_search((mode == 0) ? DIJKSTRA_SEARCH : ASTAR_SEARCH) != 0;
+            latency[mode] += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+            expanded[mode] += plan_path.get_stats().nodes_expanded;
+            cost[mode] = plan_path.get_stats().path_cost;
+        }
+        if (!reached)
+            continue;
+        if (std::fabs(cost[2] - cost[0]) > 1e-6 * cost[0] || std::fabs(cost[1] - cost[0]) > 1e-6 * cost[0])
+            mismatches++;
+        queries++;
+    }
+    std::cout << name << ": " << map.get_width() << "x" << map.get_height() << ", " << table.get_landmarks().size() << " landmarks, "
+              << table.bytes() / 1024 << " KiB (" << int(table.entry_bytes()) << " bytes per entry), built in "
+              << std::fixed << std::setprecision(1) << build_ms << " ms\n";
+    for (std::uint8_t mode = 0; mode < 3; mode++)
+        std::cout << "  " << std::left << std::setw(14) << labels[mode] << std::right << std::setw(10) << std::setprecision(0)
+                  << expanded[mode] / queries << " cells expanded " << std::setw(9) << std::setprecision(1) << latency[mode] / queries
+                  << " us   " << std::setprecision(1) << 100.0 * expanded[mode] / expanded[0] << "% of Dijkstra\n";
+    std::cout << "  cost mismatches: " << mismatches << " of " << queries << "\n";
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               MAIN PROCEDURE                               */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    // ./landmark_bench [side landmarks], defaults to a 1023 x 1023 map and 16 landmarks
+    std::uint32_t side = (argc >= 2) ? std::stoul(argv[1]) : 1023;
+    std::uint32_t landmark_count = (argc >= 3) ? std::stoul(argv[2]) : 16;
+
+    std::mt19937 random_engine(BENCH_SEED);
+    GridMap map;
+    generate_maze(map, side | 1, random_engine);
+    run_map("Maze", map, landmark_count, random_engine);
+    generate_scatter(map, side, 25, random_engine);
+    run_map("Scatter 25%", map, landmark_count, random_engine);
+    return EXIT_SUCCESS;
+}
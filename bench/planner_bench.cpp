@@ -0,0 +1,469 @@
+/**
+ * @file planner_bench.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Latency distribution, throughput and memory of every planner on seeded maps, as text, CSV and JSON
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../planner/bitboard_bfs.hpp"
+#include "../planner/component_index.hpp"
+#include "../planner/delta_stepping.hpp"
+#include "../planner/dstar_lite.hpp"
+#include "../planner/hpa_star.hpp"
+#include "../planner/landmark_table.hpp"
+#include "../planner/parallel_bfs.hpp"
+#include "../planner/setup_grid.hpp"
+#include "../planner/start_search.hpp"
+
+#define BENCH_SEED 550
+#define BENCH_QUERIES 100
+#define BENCH_LANDMARKS 16
+#define BENCH_ALLOCATION_HEADER 16 // Bytes in front of every allocation holding its size
+
+/* -------------------------------------------------------------------------- */
+/*                            ALLOCATION ACCOUNTING                           */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Bytes and allocations made through operator new, all threads together
+ */
+static std::atomic<std::uint64_t> allocated_bytes(0), allocation_count(0), live_bytes(0), peak_live_bytes(0);
+
+static void *counted_allocate(std::size_t size, std::size_t alignment)
+{
+    std::size_t offset = std::max<std::size_t>(alignment, BENCH_ALLOCATION_HEADER);
+    std::size_t total = (size + offset + alignment - 1) / alignment * alignment;
+    char *base = static_cast<char *>((alignment <= alignof(std::max_align_t)) ? std::malloc(size + offset) : std::aligned_alloc(alignment, total));
+    if (base == nullptr)
+        throw std::bad_alloc();
+    reinterpret_cast<std::size_t *>(base + offset)[-1] = size;
+    reinterpret_cast<std::size_t *>(base + offset)[-2] = offset;
+
+    allocated_bytes += size;
+    allocation_count++;
+    std::uint64_t live = live_bytes += size;
+    std::uint64_t peak = peak_live_bytes.load();
+    while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live))
+        ;
+    return base + offset;
+}
+
+static void counted_free(void *pointer)
+{
+    if (pointer == nullptr)
+        return;
+    std::size_t size = static_cast<std::size_t *>(pointer)[-1];
+    std::size_t offset = static_cast<std::size_t *>(pointer)[-2];
+    live_bytes -= size;
+    std::free(static_cast<char *>(pointer) - offset);
+}
+
+void *operator new(std::size_t size) { return counted_allocate(size, alignof(std::max_align_t)); }
+void *operator new[](std::size_t size) { return counted_allocate(size, alignof(std::max_align_t)); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return counted_allocate(size, static_cast<std::size_t>(alignment)); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return counted_allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void *pointer) noexcept { counted_free(pointer); }
+void operator delete[](void *pointer) noexcept { counted_free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { counted_free(pointer); }
+void operator delete[](void *pointer, std::size_t) noexcept { counted_free(pointer); }
+void operator delete(void *pointer, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete[](void *pointer, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept { counted_free(pointer); }
+
+/* -------------------------------------------------------------------------- */
+/*                                  PLANNERS                                  */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Work of one query, as far as the planner reports it
+ */
+struct QueryWork
+{
+    std::uint64_t nodes_expanded = 0; // Cells (or abstract nodes) expanded, 0 if not reported
+    std::uint32_t peak_frontier = 0;  // Most cells queued at once, 0 if not reported
+};
+
+using Query = std::function<QueryWork(std::uint32_t from, std::uint32_t to)>;
+using Planner = std::function<Query(const GridMap &map)>; // Builds the planner, returns its query
+
+/**
+ * @brief One planner under test; setup builds it on a map and returns the query function
+ */
+struct BenchPlanner
+{
+    std::string name;
+    Planner setup;
+};
+
+/**
+ * @brief Planner running one search type of StartSearch; 1-based endpoints
+ */
+static BenchPlanner start_search_planner(const std::string &name, const std::string &search_type, Heuristic heuristic = HEURISTIC_OCTILE)
+{
+    return {name, [search_type, heuristic](const GridMap &map) -> Query
+            {
+                auto plan_path = std::make_shared<StartSearch>(map);
+                std::shared_ptr<LandmarkTable> table;
+                AStarConfig astar_config;
+                astar_config.heuristic = heuristic;
+                plan_path->set_astar_config(astar_config);
+                if (heuristic == HEURISTIC_LANDMARKS)
+                {
+                    table = std::make_shared<LandmarkTable>(8);
+                    table->build(map, BENCH_LANDMARKS);
+                    plan_path->set_landmark_table(table.get());
+                }
+                if (search_type == JPS_PLUS_SEARCH)
+                    plan_path->prepare_jump_table();
+                std::uint32_t stride = map.get_stride();
+                return [plan_path, table, search_type, stride](std::uint32_t from, std::uint32_t to)
+                {
+                    plan_path->set_endpoints(from / stride + 1, from % stride + 1, to / stride + 1, to % stride + 1);
+                    plan_path->initiate_search(search_type);
+                    return QueryWork{plan_path->get_stats().nodes_expanded, plan_path->get_stats().peak_frontier};
+                };
+            }};
+}
+
+/**
+ * @brief Every planner of the library, in the order of the report
+ */
+static std::vector<BenchPlanner> all_planners(void)
+{
+    std::vector<BenchPlanner> planners = {
+        start_search_planner("bfs", BFS_SEARCH),
+        start_search_planner("dfs", DFS_SEARCH),
+        start_search_planner("dijkstra", DIJKSTRA_SEARCH),
+        start_search_planner("astar_octile", ASTAR_SEARCH),
+        start_search_planner("astar_landmarks", ASTAR_SEARCH, HEURISTIC_LANDMARKS),
+        start_search_planner("jps", JPS_SEARCH),
+        start_search_planner("jps_plus", JPS_PLUS_SEARCH),
+        start_search_planner("bidirectional_bfs", BIDIRECTIONAL_BFS_SEARCH),
+        start_search_planner("bidirectional_dijkstra", BIDIRECTIONAL_DIJKSTRA_SEARCH),
+    };
+    planners.push_back({"dstar_lite", [](const GridMap &map) -> Query
+                        {
+                            auto own_map = std::make_shared<GridMap>(map); // D* Lite edits its map
+                            auto planner = std::make_shared<DStarLite>(*own_map);
+                            std::uint32_t stride = map.get_stride();
+                            return [own_map, planner, stride](std::uint32_t from, std::uint32_t to)
+                            {
+                                planner->reset(from / stride + 1, from % stride + 1, to / stride + 1, to % stride + 1);
+                                planner->plan();
+                                return QueryWork{planner->get_stats().nodes_expanded, planner->get_stats().peak_frontier};
+                            };
+                        }});
+    planners.push_back({"hpa_star", [](const GridMap &map) -> Query
+                        {
+                            auto own_map = std::make_shared<GridMap>(map); // HPA* edits its map
+                            auto planner = std::make_shared<HpaStar>(*own_map);
+                            planner->build();
+                            std::uint32_t stride = map.get_stride();
+                            return [own_map, planner, stride](std::uint32_t from, std::uint32_t to)
+                            {
+                                planner->plan(from / stride + 1, from % stride + 1, to / stride + 1, to % stride + 1);
+                                return QueryWork{planner->get_stats().cells_expanded, 0};
+                            };
+                        }});
+    planners.push_back({"bitboard_bfs", [](const GridMap &map) -> Query
+                        {
+                            auto planner = std::make_shared<BitboardBFS>(map);
+                            auto path = std::make_shared<GridPath>();
+                            std::uint32_t stride = map.get_stride();
+                            return [planner, path, stride](std::uint32_t from, std::uint32_t to)
+                            {
+                                planner->find_path(from / stride, from % stride, to / stride, to % stride, *path);
+                                return QueryWork();
+                            };
+                        }});
+    planners.push_back({"parallel_bfs_field", [](const GridMap &map) -> Query
+                        {
+                            auto planner = std::make_shared<ParallelBFS>(map);
+                            auto field = std::make_shared<std::vector<std::uint32_t>>();
+                            std::uint32_t stride = map.get_stride();
+                            return [planner, field, stride](std::uint32_t from, std::uint32_t)
+                            {
+                                return QueryWork{planner->distance_field(from / stride, from % stride, *field), 0};
+                            };
+                        }});
+    planners.push_back({"delta_stepping_field", [](const GridMap &map) -> Query
+                        {
+                            auto planner = std::make_shared<DeltaStepping>(map);
+                            auto field = std::make_shared<std::vector<double>>();
+                            std::uint32_t stride = map.get_stride();
+                            return [planner, field, stride](std::uint32_t from, std::uint32_t)
+                            {
+                                return QueryWork{planner->cost_field(from / stride, from % stride, *field), 0};
+                            };
+                        }});
+    return planners;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                MEASUREMENT                                 */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Figures of one planner on one map
+ */
+struct BenchResult
+{
+    std::uint32_t map_size = 0;
+    std::uint32_t coverage = 0;
+    std::string planner;
+    std::uint32_t queries = 0;
+    double setup_ms = 0;                 // Construction and preprocessing
+    double mean_ns = 0;
+    std::uint64_t p50_ns = 0, p90_ns = 0, p99_ns = 0, max_ns = 0;
+    double nodes_per_second = 0;         // 0 if the planner does not report expansions
+    std::uint32_t peak_frontier = 0;     // Largest over the queries, 0 if not reported
+    std::uint64_t setup_bytes = 0;       // Heap bytes still held after setup and the warm-up pass
+    std::uint64_t peak_bytes = 0;        // Highest heap footprint above the map, setup included
+    double bytes_per_query = 0;          // Heap bytes allocated per steady-state query
+    double allocations_per_query = 0;
+};
+
+/**
+ * @brief Nearest-rank percentile of sorted samples
+ */
+static std::uint64_t percentile(const std::vector<std::uint64_t> &sorted, double fraction)
+{
+    std::size_t rank = static_cast<std::size_t>(fraction * sorted.size() + 0.999999);
+    return sorted[std::min(sorted.size(), std::max<std::size_t>(rank, 1)) - 1];
+}
+
+/**
+ * @brief Build the planner, warm it up with one pass over the queries, then time every query
+ *
+ * The warm-up pass grows every buffer to the largest query, so the timed pass sees the steady
+ * state a long-running planner lives in and any allocation left in it is a real per-query cost.
+ */
+static BenchResult run_planner(const BenchPlanner &bench_planner, const GridMap &map, const std::vector<std::uint32_t> &pairs)
+{
+    BenchResult result;
+    result.planner = bench_planner.name;
+    result.queries = pairs.size() / 2;
+
+    std::uint64_t live_before = live_bytes.load();
+    peak_live_bytes = live_before;
+    auto setup_begin = std::chrono::steady_clock::now();
+    Query query = bench_planner.setup(map);
+    result.setup_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - setup_begin).count();
+    for (std::size_t pair = 0; pair + 1 < pairs.size(); pair += 2)
+        query(pairs[pair], pairs[pair + 1]);
+    result.setup_bytes = live_bytes.load() - live_before;
+
+    std::vector<std::uint64_t> latency;
+    latency.reserve(result.queries);
+    std::uint64_t expanded = 0;
+    std::uint64_t bytes_before = allocated_bytes.load(), allocations_before = allocation_count.load();
+    for (std::size_t pair = 0; pair + 1 < pairs.size(); pair += 2)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        QueryWork work = query(pairs[pair], pairs[pair + 1]);
+        latency.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+        expanded += work.nodes_expanded;
+        result.peak_frontier = std::max(result.peak_frontier, work.peak_frontier);
+    }
+    std::uint64_t measured_bytes = allocated_bytes.load() - bytes_before;
+    std::uint64_t measured_allocations = allocation_count.load() - allocations_before;
+    result.bytes_per_query = static_cast<double>(measured_bytes) / result.queries;
+    result.allocations_per_query = static_cast<double>(measured_allocations) / result.queries;
+    result.peak_bytes = peak_live_bytes.load() - live_before;
+
+    std::uint64_t total_ns = 0;
+    for (std::uint64_t sample : latency)
+        total_ns += sample;
+    std::sort(latency.begin(), latency.end());
+    result.mean_ns = static_cast<double>(total_ns) / result.queries;
+    result.p50_ns = percentile(latency, 0.50);
+    result.p90_ns = percentile(latency, 0.90);
+    result.p99_ns = percentile(latency, 0.99);
+    result.max_ns = latency.back();
+    result.nodes_per_second = (total_ns == 0) ? 0 : expanded * 1e9 / total_ns;
+    return result;
+}
+
+/**
+ * @brief Seeded start/goal pairs on free cells joined 4-connected, so every planner can solve them
+ *
+ * @return std::vector<std::uint32_t> from, to, from, to, ... as cell indices
+ */
+static std::vector<std::uint32_t> pick_pairs(const GridMap &map, std::uint32_t queries, std::mt19937 &random_engine)
+{
+    ComponentIndex components(4);
+    components.build(map);
+    std::vector<std::uint32_t> free_cells;
+    for (std::uint32_t y = 0; y < map.get_height(); y++)
+        for (std::uint32_t x = 0; x < map.get_width(); x++)
+            if (map.at(y, x) != BLOCK_OBSTACLE)
+                free_cells.push_back(map.index(y, x));
+
+    std::vector<std::uint32_t> pairs;
+    std::uint32_t stride = map.get_stride();
+    while (pairs.size() < 2 * queries)
+    {
+        std::uint32_t from = free_cells[random_engine() % free_cells.size()];
+        std::uint32_t to = free_cells[random_engine() % free_cells.size()];
+        if (from != to && components.connected(from / stride, from % stride, to / stride, to % stride))
+        {
+            pairs.push_back(from);
+            pairs.push_back(to);
+        }
+    }
+    return pairs;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   OUTPUT                                   */
+/* -------------------------------------------------------------------------- */
+
+static void write_csv(const std::string &path, const std::vector<BenchResult> &results)
+{
+    std::ofstream out(path);
+    out << "map_size,coverage,planner,queries,setup_ms,mean_ns,p50_ns,p90_ns,p99_ns,max_ns,nodes_per_second,"
+           "peak_frontier,setup_bytes,peak_bytes,bytes_per_query,allocations_per_query\n";
+    for (const BenchResult &result : results)
+        out << result.map_size << "," << result.coverage << "," << result.planner << "," << result.queries << ","
+            << result.setup_ms << "," << result.mean_ns << "," << result.p50_ns << "," << result.p90_ns << ","
+            << result.p99_ns << "," << result.max_ns << "," << result.nodes_per_second << "," << result.peak_frontier << ","
+            << result.setup_bytes << "," << result.peak_bytes << "," << result.bytes_per_query << "," << result.allocations_per_query << "\n";
+}
+
+static void write_json(const std::string &path, const std::vector<BenchResult> &results)
+{
+    std::ofstream out(path);
+    out << "{\n  \"seed\": " << BENCH_SEED << ",\n  \"results\": [";
+    for (std::size_t pos = 0; pos < results.size(); pos++)
+    {
+        const BenchResult &result = results[pos];
+        out << (pos == 0 ? "\n" : ",\n") << "    {\"map_size\": " << result.map_size << ", \"coverage\": " << result.coverage
+            << ", \"planner\": \"" << result.planner << "\", \"queries\": " << result.queries << ", \"setup_ms\": " << result.setup_ms
+            << ", \"mean_ns\": " << result.mean_ns << ", \"p50_ns\": " << result.p50_ns << ", \"p90_ns\": " << result.p90_ns
+            << ", \"p99_ns\": " << result.p99_ns << ", \"max_ns\": " << result.max_ns << ", \"nodes_per_second\": " << result.nodes_per_second
+            << ", \"peak_frontier\": " << result.peak_frontier << ", \"setup_bytes\": " << result.setup_bytes
+            << ", \"peak_bytes\": " << result.peak_bytes << ", \"bytes_per_query\": " << result.bytes_per_query
+            << ", \"allocations_per_query\": " << result.allocations_per_query << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static void print_result(const BenchResult &result)
+{
+    std::cout << "  " << std::left << std::setw(24) << result.planner << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << result.p50_ns / 1e3 << std::setw(10) << result.p90_ns / 1e3 << std::setw(10) << result.p99_ns / 1e3
+              << std::setw(11) << result.nodes_per_second / 1e6 << std::setw(10) << result.peak_frontier
+              << std::setw(11) << result.setup_bytes / 1024 << std::setw(11) << std::setprecision(0) << result.bytes_per_query
+              << std::setw(9) << std::setprecision(1) << result.allocations_per_query << "\n";
+}
+
+/**
+ * @brief Comma separated numbers
+ */
+static std::vector<std::uint32_t> parse_list(const std::string &text)
+{
+    std::vector<std::uint32_t> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        values.push_back(std::stoul(item));
+    return values;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               MAIN PROCEDURE                               */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    // ./planner_bench [--sizes 256,1024] [--coverages 10,25] [--queries N] [--planners bfs,dijkstra] [--csv file] [--json file]
+    //                 [--max-allocations N]
+    std::vector<std::uint32_t> sizes = {256, 1024}, coverages = {10, 25};
+    std::uint32_t queries = BENCH_QUERIES;
+    double max_allocations = -1; // Allocations per steady-state query a planner may make, < 0 -> no limit
+    std::string csv_path, json_path, planner_filter;
+    for (int arg = 1; arg + 1 < argc; arg += 2)
+    {
+        std::string option = argv[arg], value = argv[arg + 1];
+        if (option == "--sizes")
+            sizes = parse_list(value);
+        else if (option == "--coverages")
+            coverages = parse_list(value);
+        else if (option == "--queries")
+            queries = std::max<std::uint32_t>(1, std::stoul(value));
+        else if (option == "--planners")
+            planner_filter = "," + value + ",";
+        else if (option == "--csv")
+            csv_path = value;
+        else if (option == "--json")
+            json_path = value;
+        else if (option == "--max-allocations")
+            max_allocations = std::stod(value);
+        else
+        {
+            std::cerr << "Unknown option " << option << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<BenchPlanner> planners = all_planners();
+    std::vector<BenchResult> results;
+    for (std::uint32_t size : sizes)
+        for (std::uint32_t coverage : coverages)
+        {
+            GridMap map;
+            Setup_Grid(map, size, size, coverage, BENCH_SEED + size * 101 + coverage).initialize_grid();
+            std::mt19937 random_engine(BENCH_SEED);
+            std::vector<std::uint32_t> pairs = pick_pairs(map, queries, random_engine);
+
+            std::cout << size << "x" << size << ", " << coverage << "% obstacles, " << queries << " queries\n"
+                      << "  " << std::left << std::setw(24) << "planner" << std::right << std::setw(10) << "p50 us" << std::setw(10)
+                      << "p90 us" << std::setw(10) << "p99 us" << std::setw(11) << "Mnodes/s" << std::setw(10) << "frontier"
+                      << std::setw(11) << "setup KiB" << std::setw(11) << "B/query" << std::setw(9) << "allocs" << "\n";
+            for (const BenchPlanner &planner : planners)
+            {
+                if (!planner_filter.empty() && planner_filter.find("," + planner.name + ",") == std::string::npos)
+                    continue;
+                BenchResult result = run_planner(planner, map, pairs);
+                result.map_size = size;
+                result.coverage = coverage;
+                print_result(result);
+                results.push_back(result);
+            }
+        }
+
+    if (!csv_path.empty())
+        write_csv(csv_path, results);
+    if (!json_path.empty())
+        write_json(json_path, results);
+
+    bool allocation_free = true;
+    for (const BenchResult &result : results)
+        if (max_allocations >= 0 && result.allocations_per_query > max_allocations)
+        {
+            std::cerr << result.planner << " at " << result.map_size << "x" << result.map_size << ", " << result.coverage
+                      << "% makes " << result.allocations_per_query << " allocations per query\n";
+            allocation_free = false;
+        }
+    return allocation_free ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file batch_search.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Many start/goal queries on one map, answered in parallel
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "batch_search.hpp"
+
+/**
+ * @brief Start the pool and give every worker its own search context on map
+ *
+ * @param map Map to search, must outlive the BatchSearch and stay unchanged while a batch runs
+ * @param thread_count Workers including the calling thread, 0 -> one per hardware thread
+ */
+BatchSearch::BatchSearch(const GridMap &map, std::uint32_t thread_count) : pool(thread_count)
+{
+    for (std::uint32_t worker = 0; worker < this->pool.size(); worker++)
+        this->contexts.emplace_back(new StartSearch(map));
+}
+
+/**
+ * @brief Set the move costs of every worker's context
+ *
+ * @param move_costs
+ */
+void BatchSearch::set_move_costs(MoveCosts move_costs)
+{
+    for (std::unique_ptr<StartSearch> &context : this->contexts)
+        context->set_move_costs(move_costs);
+}
+
+/**
+ * @brief Set the A* configuration of every worker's context
+ *
+ * @param astar_config
+ */
+void BatchSearch::set_astar_config(AStarConfig astar_config)
+{
+    for (std::unique_ptr<StartSearch> &context : this->contexts)
+        context->set_astar_config(astar_config);
+}
+
+/**
+ * @brief Share one cache of goal fields between every worker's context
+ *
+ * @param goal_field_cache Cache of the searched map, nullptr detaches it
+ */
+void BatchSearch::set_goal_field_cache(GoalFieldCache *goal_field_cache)
+{
+    for (std::unique_ptr<StartSearch> &context : this->contexts)
+        context->set_goal_field_cache(goal_field_cache);
+}
+
+/**
+ * @brief Share one landmark table between every worker's context, for A* with HEURISTIC_LANDMARKS
+ *
+ * @param landmark_table Table of the searched map, nullptr detaches it
+ */
+void BatchSearch::set_landmark_table(const LandmarkTable *landmark_table)
+{
+    for (std::unique_ptr<StartSearch> &context : this->contexts)
+        context->set_landmark_table(landmark_table);
+}
+
+/**
+ * @brief Record the time of every query of every worker in one histogram
+ *
+ * @param latency_histogram Histogram that must outlive the batch search; nullptr detaches it
+ */
+void BatchSearch::set_latency_histogram(LatencyHistogram *latency_histogram)
+{
+    for (std::unique_ptr<StartSearch> &context : this->contexts)
+        context->set_latency_histogram(latency_histogram);
+}
+
+/**
+ * @brief Answer queries[0 .. query_count-1] with one search type
+ *
+ * @param queries Start/goal pairs, 1-based
+ * @param query_count
+ * @param search_type Search Tag Type
+ * @param results Array of query_count results, results[i] answers queries[i]
+ * @throw std::out_of_range if a query lies outside the map (the other queries are still answered)
+ */
+void BatchSearch::run(const PathQuery *queries, std::size_t query_count, const std::string &search_type, PathResult *results)
+{
+    this->pool.parallel_for(query_count, [&](std::uint32_t worker, std::size_t index)
+                            {
+                                StartSearch &context = *this->contexts[worker];
+                                const PathQuery &query = queries[index];
+                                PathResult &result = results[index];
+                                context.set_endpoints(query.start_y, query.start_x, query.end_y, query.end_x);
+                                result.steps = context.initiate_search(search_type);
+                                result.path = context.get_path();
+                                result.stats = context.get_stats(); });
+}
+
+/**
+ * @brief Answer every query with one search type
+ *
+ * @param queries Start/goal pairs, 1-based
+ * @param search_type Search Tag Type
+ * @return std::vector<PathResult> Results in the order of queries
+ */
+std::vector<PathResult> BatchSearch::run(const std::vector<PathQuery> &queries, const std::string &search_type)
+{
+    std::vector<PathResult> results(queries.size());
+    run(queries.data(), queries.size(), search_type, results.data());
+    return results;
+}
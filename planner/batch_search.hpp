@@ -0,0 +1,70 @@
+/**
+ * @file batch_search.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Many start/goal queries on one map, answered in parallel
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_BATCH_SEARCH_HPP
+#define PLANNER_BATCH_SEARCH_HPP
+
+#include "start_search.hpp"
+#include "thread_pool.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One start/goal pair, 1-based like the StartSearch constructor
+ */
+struct PathQuery
+{
+    std::uint32_t start_y, start_x;
+    std::uint32_t end_y, end_x;
+};
+
+/**
+ * @brief Answer to one PathQuery
+ */
+struct PathResult
+{
+    std::uint32_t steps = 0;                          // Number of Steps, 0 if the search failed
+    GridPath path;                                    // Cells from start to goal
+    SearchStats stats;                                // Statistics of the search
+};
+
+/* --------------------------- BATCH SEARCH CLASS --------------------------- */
+/**
+ * @brief Runs batches of queries against one map on a work-stealing thread pool
+ *
+ * Every worker owns one StartSearch context for the lifetime of the BatchSearch, so its
+ * per-cell buffers (and the JPS+ table) are allocated once and reused by every query the
+ * worker picks up.
+ *
+ * A query that cannot be answered leaves steps at 0 in its PathResult; workers never write to the
+ * console, so failed queries cost no stream lock or flush.
+ */
+class BatchSearch
+{
+private:
+    ThreadPool pool;
+    std::vector<std::unique_ptr<StartSearch>> contexts; // One search context per worker
+
+public:
+    explicit BatchSearch(const GridMap &map, std::uint32_t thread_count = 0);
+    void set_move_costs(MoveCosts move_costs);
+    void set_astar_config(AStarConfig astar_config);
+    void set_goal_field_cache(GoalFieldCache *goal_field_cache);
+    void set_landmark_table(const LandmarkTable *landmark_table);
+    void set_latency_histogram(LatencyHistogram *latency_histogram);
+    std::uint32_t thread_count(void) const { return pool.size(); }
+    void run(const PathQuery *queries, std::size_t query_count, const std::string &search_type, PathResult *results);
+    std::vector<PathResult> run(const std::vector<PathQuery> &queries, const std::string &search_type);
+};
+
+#endif // PLANNER_BATCH_SEARCH_HPP
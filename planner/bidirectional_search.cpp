@@ -0,0 +1,297 @@
+/**
+ * @file bidirectional_search.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Bidirectional BFS and Dijkstra for StartSearch: one frontier from the start, one from the goal
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "start_search.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#define FORWARD 0
+#define BACKWARD 1
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Size the backward buffers, which only the bidirectional searches use
+ *
+ * They are grown on the first bidirectional query, so contexts that never run one do not pay
+ * for a second set of per-cell arrays.
+ */
+void StartSearch::reserve_backward(void)
+{
+    if (this->parent_backward.size() < this->cell_total)
+    {
+        this->parent_backward.resize(this->cell_total);
+        this->frontier_backward.resize(this->cell_total);
+        this->distance_backward.resize(this->cell_total);
+        this->visit_stamp_backward.resize(this->cell_total, 0); // Older than any epoch
+    }
+    this->open_list_backward.reserve(this->cell_total);
+}
+
+/**
+ * @brief Stitch the path from the forward predecessors and the backward successors
+ *
+ * @param forward_end Last cell of the forward half, reached from the start
+ * @param backward_start First cell of the backward half, reached from the goal; equal to
+ *                       forward_end when both halves meet in one cell
+ * @return std::uint32_t Number of cells on the path
+ */
+std::uint32_t StartSearch::extract_bidirectional_path(std::uint32_t forward_end, std::uint32_t backward_start)
+{
+    PLANNER_STAT(auto extract_begin = std::chrono::steady_clock::now());
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+
+    std::uint32_t forward_length = 1;
+    for (std::uint32_t cell = forward_end; cell != start; cell = this->parent[cell])
+        forward_length++;
+
+    // The meeting cell is already the last cell of the forward half
+    bool backward_empty = (forward_end == backward_start) && (backward_start == goal);
+    std::uint32_t first = (forward_end == backward_start) ? this->parent_backward[backward_start] : backward_start;
+    std::uint32_t backward_length = 0;
+    if (!backward_empty)
+    {
+        backward_length = 1;
+        for (std::uint32_t cell = first; cell != goal; cell = this->parent_backward[cell])
+            backward_length++;
+    }
+
+    std::uint32_t length = forward_length + backward_length;
+    this->path.cells.resize(length);
+    std::uint32_t cell = forward_end;
+    for (std::uint32_t pos = forward_length; pos > 0; pos--)
+    {
+        this->path.cells[pos - 1] = cell;
+        cell = this->parent[cell];
+    }
+    cell = first;
+    for (std::uint32_t pos = forward_length; pos < length; pos++)
+    {
+        this->path.cells[pos] = cell;
+        cell = this->parent_backward[cell];
+    }
+
+    this->cell_count = length; // Update the list count
+    PLANNER_STAT(this->stats.extract_ns += elapsed_ns(extract_begin));
+    return this->cell_count;
+}
+
+/* -------------------------- BIDIRECTIONAL BFS ---------------------------- */
+/**
+ * @brief Perform BFS from the start and from the goal at once
+ *
+ * Each round expands one whole level of the side with the smaller frontier. A cell discovered by
+ * both sides closes a path of d_forward + d_backward moves; the shortest one is always among those
+ * found while finishing the level in which the first meeting happens, so the search stops after
+ * that level. On an open map each side only grows to half the path length, about half the cells
+ * of bfs_search. The step count equals that of BFS_SEARCH (the path may differ among equals).
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::bidirectional_bfs_search(void)
+{
+    reserve_backward();
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+    std::uint32_t closed = this->epoch + 1;
+
+    std::uint32_t *queue[2] = {this->frontier.data(), this->frontier_backward.data()};
+    std::uint32_t *parents[2] = {this->parent.data(), this->parent_backward.data()};
+    double *distances[2] = {this->distance_list.data(), this->distance_backward.data()};
+    std::uint32_t *stamps[2] = {this->visit_stamp.data(), this->visit_stamp_backward.data()};
+    std::uint32_t head[2] = {0, 0}, tail[2] = {0, 0};
+
+    double best = std::numeric_limits<double>::infinity(); // Moves of the shortest meeting so far
+    std::uint32_t meeting = start;
+
+    // Seed both sides, a goal on an obstacle can never be reached
+    if (this->cells[goal] != BLOCK_OBSTACLE)
+    {
+        const std::uint32_t roots[2] = {start, goal};
+        for (std::uint8_t side = FORWARD; side <= BACKWARD; side++)
+        {
+            std::uint32_t root = roots[side];
+            queue[side][tail[side]++] = root;
+            parents[side][root] = root;
+            distances[side][root] = 0;
+            stamps[side][root] = closed;
+        }
+        if (start == goal)
+            best = 0;
+    }
+
+    while (best == std::numeric_limits<double>::infinity() && head[FORWARD] != tail[FORWARD] && head[BACKWARD] != tail[BACKWARD])
+    {
+        PLANNER_STAT(this->stats.peak_frontier = std::max(this->stats.peak_frontier, tail[FORWARD] - head[FORWARD] + tail[BACKWARD] - head[BACKWARD]));
+
+        // Grow the smaller frontier by one full level
+        std::uint8_t side = (tail[FORWARD] - head[FORWARD] <= tail[BACKWARD] - head[BACKWARD]) ? FORWARD : BACKWARD;
+        std::uint8_t other = 1 - side;
+        std::uint32_t *side_queue = queue[side], *side_parent = parents[side], *side_stamp = stamps[side];
+        double *side_distance = distances[side], *other_distance = distances[other];
+        const std::uint32_t *other_stamp = stamps[other];
+        std::uint32_t level_end = tail[side];
+        while (head[side] != level_end)
+        {
+            std::uint32_t cell = side_queue[head[side]++];
+            std::uint32_t y = cell / this->stride;
+            std::uint32_t x = cell % this->stride;
+            expand_cell(y, x);
+
+            for (std::uint8_t dir = 0; dir < 4; dir++)
+            {
+                std::int64_t neighbour_y = static_cast<std::int64_t>(y) + NEIGHBOUR_DY[dir];
+                std::int64_t neighbour_x = static_cast<std::int64_t>(x) + NEIGHBOUR_DX[dir];
+                if (!is_passable(neighbour_y, neighbour_x))
+                    continue;
+                std::uint32_t neighbour = cell_index(neighbour_y, neighbour_x);
+                if (side_stamp[neighbour] == closed)
+                    continue;
+
+                side_stamp[neighbour] = closed;
+                side_parent[neighbour] = cell;
+                side_distance[neighbour] = side_distance[cell] + 1;
+                side_queue[tail[side]++] = neighbour;
+
+                if (other_stamp[neighbour] == closed && side_distance[neighbour] + other_distance[neighbour] < best)
+                {
+                    best = side_distance[neighbour] + other_distance[neighbour];
+                    meeting = neighbour;
+                }
+            }
+        }
+    }
+    PLANNER_STAT(this->stats.nodes_pushed = tail[FORWARD] + tail[BACKWARD]);
+
+    std::uint32_t steps = 0;
+    if (best != std::numeric_limits<double>::infinity())
+        steps = extract_bidirectional_path(meeting, meeting);
+    return steps;
+}
+
+/* ------------------------ BIDIRECTIONAL DIJKSTRA ------------------------- */
+/**
+ * @brief Perform Dijkstra from the start and from the goal at once
+ *
+ * Every step settles the top cell of the side with the fewer open cells. Whenever a move joins a
+ * cell of one side to a cell the other side has reached, mu = d_forward + move + d_backward is a
+ * complete path. The search stops once top_forward + top_backward >= mu: any path not yet seen
+ * would have to leave both settled regions and cost at least that sum. Costs equal those of
+ * DIJKSTRA_SEARCH.
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::bidirectional_dijkstra_search(void)
+{
+    reserve_backward();
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+    std::uint32_t reached = this->epoch;
+    std::uint32_t closed = this->epoch + 1;
+    const double move_cost[8] = {this->move_costs.straight, this->move_costs.straight, this->move_costs.straight, this->move_costs.straight,
+                                 this->move_costs.diagonal, this->move_costs.diagonal, this->move_costs.diagonal, this->move_costs.diagonal};
+
+    IndexedHeap<double> *open[2] = {&this->open_list, &this->open_list_backward};
+    std::uint32_t *parents[2] = {this->parent.data(), this->parent_backward.data()};
+    double *distances[2] = {this->distance_list.data(), this->distance_backward.data()};
+    std::uint32_t *stamps[2] = {this->visit_stamp.data(), this->visit_stamp_backward.data()};
+    open[FORWARD]->clear();
+    open[BACKWARD]->clear();
+
+    double mu = std::numeric_limits<double>::infinity(); // Cost of the best complete path so far
+    std::uint32_t forward_end = start, backward_start = start;
+
+    // Seed both sides, a goal on an obstacle can never be reached
+    if (this->cells[goal] != BLOCK_OBSTACLE)
+    {
+        const std::uint32_t roots[2] = {start, goal};
+        for (std::uint8_t side = FORWARD; side <= BACKWARD; side++)
+        {
+            std::uint32_t root = roots[side];
+            parents[side][root] = root;
+            distances[side][root] = 0;
+            stamps[side][root] = reached;
+            open[side]->push(root, 0);
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+        if (start == goal)
+            mu = 0;
+    }
+
+    while (!open[FORWARD]->empty() && !open[BACKWARD]->empty())
+    {
+        PLANNER_STAT(this->stats.peak_frontier = std::max(this->stats.peak_frontier, open[FORWARD]->size() + open[BACKWARD]->size()));
+        if (open[FORWARD]->top_key() + open[BACKWARD]->top_key() >= mu)
+            break;
+
+        // Settle the top cell of the smaller frontier
+        std::uint8_t side = (open[FORWARD]->size() <= open[BACKWARD]->size()) ? FORWARD : BACKWARD;
+        std::uint8_t other = 1 - side;
+        std::uint32_t cell = open[side]->pop();
+        std::uint32_t y = cell / this->stride;
+        std::uint32_t x = cell % this->stride;
+        double distance = distances[side][cell];
+        stamps[side][cell] = closed;
+        PLANNER_STAT(this->stats.nodes_settled++);
+        expand_cell(y, x);
+
+        for (std::uint8_t dir = 0; dir < 8; dir++)
+        {
+            std::int64_t neighbour_y = static_cast<std::int64_t>(y) + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = static_cast<std::int64_t>(x) + NEIGHBOUR_DX[dir];
+            if (!is_passable(neighbour_y, neighbour_x))
+                continue;
+            std::uint32_t neighbour = cell_index(neighbour_y, neighbour_x);
+            double through = distance + move_cost[dir];
+
+            // Joins the other side: a complete path, whether or not this side has settled the cell
+            if (stamps[other][neighbour] >= reached && through + distances[other][neighbour] < mu)
+            {
+                mu = through + distances[other][neighbour];
+                forward_end = (side == FORWARD) ? cell : neighbour;
+                backward_start = (side == FORWARD) ? neighbour : cell;
+            }
+
+            if (stamps[side][neighbour] == closed)
+                continue;
+            if (stamps[side][neighbour] == reached && through >= distances[side][neighbour])
+                continue;
+
+            distances[side][neighbour] = through;
+            stamps[side][neighbour] = reached;
+            parents[side][neighbour] = cell;
+            if (open[side]->contains(neighbour))
+            {
+                open[side]->decrease_key(neighbour, through);
+                PLANNER_STAT(this->stats.decrease_keys++);
+            }
+            else
+            {
+                open[side]->push(neighbour, through);
+                PLANNER_STAT(this->stats.nodes_pushed++);
+            }
+        }
+    }
+
+    std::uint32_t steps = 0;
+    if (mu != std::numeric_limits<double>::infinity())
+    {
+        this->stats.path_cost = mu;
+        steps = extract_bidirectional_path(forward_end, backward_start);
+    }
+    return steps;
+}
@@ -0,0 +1,533 @@
+/**
+ * @file bitboard_bfs.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Word-parallel BFS over bit-packed occupancy planes
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "bitboard_bfs.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#define BITBOARD_LANES 4 // Plane words computed per step
+#else
+#define BITBOARD_LANES 1
+#endif
+
+/**
+ * @brief Construct an engine with no map loaded
+ */
+BitboardBFS::BitboardBFS(void)
+{
+    this->width = 0;
+    this->height = 0;
+    this->words_per_row = 0;
+    this->row_words = 0;
+    this->summary_words = 0;
+    this->map_stride = 0;
+}
+
+/**
+ * @brief Construct an engine and pack the obstacles of map
+ *
+ * @param map
+ */
+BitboardBFS::BitboardBFS(const GridMap &map) : BitboardBFS()
+{
+    load(map);
+}
+
+/**
+ * @brief Pack the free cells of map into the free bitplane. Call again after the map changes.
+ *
+ * Every cell that is not BLOCK_OBSTACLE counts as free.
+ *
+ * @param map
+ * @throw std::length_error if the padded planes do not fit a 32-bit word index
+ */
+void BitboardBFS::load(const GridMap &map)
+{
+    this->width = map.get_width();
+    this->height = map.get_height();
+    this->map_stride = map.get_stride();
+    this->words_per_row = (this->width + 63) / 64;
+    // One guard word in front, at least one behind, and enough slack that a 4-word AVX2 step
+    // starting on the last data word, plus its one-word lookahead, stays inside the row
+    this->row_words = (this->words_per_row + 5 + 3) / 4 * 4;
+
+    std::uint64_t plane_size = (static_cast<std::uint64_t>(this->height) + 2) * this->row_words;
+    if (plane_size > UINT32_MAX)
+        throw std::length_error("Grid is too large for the bitboard planes");
+
+    this->free_plane.assign(plane_size, 0);
+    this->visited.assign(plane_size, 0);
+    this->frontier.assign(plane_size, 0);
+    this->next_frontier.assign(plane_size, 0);
+
+    this->summary_words = (this->row_words + 63) / 64;
+    std::size_t summary_size = (static_cast<std::size_t>(this->height) + 2) * this->summary_words;
+    this->frontier_summary.assign(summary_size, 0);
+    this->next_summary.assign(summary_size, 0);
+    this->data_words.assign(this->summary_words, 0);
+    for (std::uint32_t w = 1; w <= this->words_per_row; w++)
+        this->data_words[w / 64] |= std::uint64_t(1) << (w % 64);
+
+    for (std::uint32_t y = 0; y < this->height; y++)
+    {
+        const std::uint8_t *row = map.data() + static_cast<std::size_t>(y) * this->map_stride;
+        std::uint64_t *plane_row = this->free_plane.data() + plane_word(y, 0);
+        for (std::uint32_t x = 0; x < this->width; x++)
+            if (row[x] != BLOCK_OBSTACLE)
+                plane_row[x / 64] |= std::uint64_t(1) << (x % 64);
+    }
+}
+
+/**
+ * @brief Compute BITBOARD_LANES next-frontier words of one row and fold them into visited
+ *
+ * @param base First word of the plane row
+ * @param w First word to compute, 1 .. words_per_row
+ * @return std::uint64_t Bit l set when word w + l holds a new cell
+ */
+std::uint64_t BitboardBFS::expand_words(std::size_t base, std::uint32_t w)
+{
+    const std::uint64_t *centre = this->frontier.data() + base + w;
+    const std::uint64_t *above = centre - this->row_words;
+    const std::uint64_t *below = centre + this->row_words;
+    const std::uint64_t *free_cells = this->free_plane.data() + base + w;
+    std::uint64_t *seen = this->visited.data() + base + w;
+    std::uint64_t *next = this->next_frontier.data() + base + w;
+
+#ifdef __AVX2__
+    // Words w-1 and w+1 are plain unaligned loads one word off, so the carries across word
+    // boundaries come out of the same shifts as the in-word neighbours
+    __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(centre));
+    __m256i c_prev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(centre - 1));
+    __m256i c_next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(centre + 1));
+    __m256i spread = _mm256_or_si256(c, _mm256_slli_epi64(c, 1));
+    spread = _mm256_or_si256(spread, _mm256_srli_epi64(c_prev, 63));
+    spread = _mm256_or_si256(spread, _mm256_srli_epi64(c, 1));
+    spread = _mm256_or_si256(spread, _mm256_slli_epi64(c_next, 63));
+    spread = _mm256_or_si256(spread, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above)));
+    spread = _mm256_or_si256(spread, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below)));
+    spread = _mm256_and_si256(spread, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(free_cells)));
+    __m256i old_seen = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(seen));
+    __m256i bits = _mm256_andnot_si256(old_seen, spread);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(next), bits);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(seen), _mm256_or_si256(old_seen, bits));
+    // One bit per non-zero 64-bit lane
+    __m256i zero_lanes = _mm256_cmpeq_epi64(bits, _mm256_setzero_si256());
+    return ~static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(zero_lanes))) & 0xF;
+#else
+    std::uint64_t spread = centre[0] | (centre[0] << 1) | (centre[-1] >> 63) |
+                           (centre[0] >> 1) | (centre[1] << 63) | above[0] | below[0];
+    std::uint64_t bits = spread & free_cells[0] & ~seen[0];
+    next[0] = bits;
+    seen[0] |= bits;
+    return bits != 0;
+#endif
+}
+
+/**
+ * @brief Compute the next frontier of one plane row, visiting only words next to frontier words
+ *
+ * @param row Plane row, 1 .. height
+ * @param record_history Append the non-zero words to the frontier-layer history
+ * @param distance Distance row of the map row, written for every new cell; nullptr for none
+ * @param layer Distance of the new cells
+ * @return true if the row holds any new cell
+ */
+bool BitboardBFS::expand_row(std::uint32_t row, bool record_history, std::uint32_t *distance, std::uint32_t layer)
+{
+    std::size_t base = static_cast<std::size_t>(row) * this->row_words;
+    const std::uint64_t *summary_centre = this->frontier_summary.data() + static_cast<std::size_t>(row) * this->summary_words;
+    const std::uint64_t *summary_above = summary_centre - this->summary_words;
+    const std::uint64_t *summary_below = summary_centre + this->summary_words;
+    std::uint64_t *summary_next = this->next_summary.data() + static_cast<std::size_t>(row) * this->summary_words;
+    std::uint32_t done = 0; // Words below this index were already computed by a wider step
+    bool any = false;
+
+    for (std::uint32_t s = 0; s < this->summary_words; s++)
+    {
+        // Same word above and below, neighbouring words in the row itself
+        std::uint64_t c = summary_centre[s];
+        std::uint64_t mask = summary_above[s] | summary_below[s] | c | (c << 1) | (c >> 1);
+        if (s > 0)
+            mask |= summary_centre[s - 1] >> 63;
+        if (s + 1 < this->summary_words)
+            mask |= summary_centre[s + 1] << 63;
+        mask &= this->data_words[s];
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            std::uint32_t w = s * 64 + __builtin_ctzll(mask);
+            if (w < done)
+                continue;
+            std::uint64_t lanes = expand_words(base, w);
+            done = w + BITBOARD_LANES;
+            for (; lanes != 0; lanes &= lanes - 1)
+            {
+                std::uint32_t word = w + __builtin_ctzll(lanes);
+                summary_next[word / 64] |= std::uint64_t(1) << (word % 64);
+                any = true;
+                if (record_history)
+                {
+                    this->layer_word_index.push_back(base + word);
+                    this->layer_word_bits.push_back(this->next_frontier[base + word]);
+                }
+                if (distance != nullptr)
+                    for (std::uint64_t bits = this->next_frontier[base + word]; bits != 0; bits &= bits - 1)
+                        distance[(word - 1) * 64 + __builtin_ctzll(bits)] = layer;
+            }
+        }
+    }
+    return any;
+}
+
+/**
+ * @brief Zero the words of the current frontier and its summary, row by row
+ */
+void BitboardBFS::clear_frontier(void)
+{
+    for (std::uint32_t row : this->active_rows)
+    {
+        std::size_t base = static_cast<std::size_t>(row) * this->row_words;
+        std::uint64_t *summary = this->frontier_summary.data() + static_cast<std::size_t>(row) * this->summary_words;
+        for (std::uint32_t s = 0; s < this->summary_words; s++)
+        {
+            for (std::uint64_t mask = summary[s]; mask != 0; mask &= mask - 1)
+                this->frontier[base + s * 64 + __builtin_ctzll(mask)] = 0;
+            summary[s] = 0;
+        }
+    }
+    this->active_rows.clear();
+}
+
+/**
+ * @brief Spread seeds along the free runs of one row, towards higher bits
+ *
+ * Adding the seeds to the free mask carries through every free bit above a seed, so the bits
+ * that flip are exactly the rest of its run (plus the first blocked bit, masked off by free).
+ */
+static inline std::uint64_t fill_up(std::uint64_t seeds, std::uint64_t free_cells)
+{
+    return (((free_cells + seeds) ^ free_cells ^ seeds) & free_cells) | seeds;
+}
+
+/**
+ * @brief Spread seeds along the free runs of one row, towards lower bits (occluded fill)
+ */
+static inline std::uint64_t fill_down(std::uint64_t seeds, std::uint64_t free_cells)
+{
+    seeds |= free_cells & (seeds >> 1);
+    free_cells &= free_cells >> 1;
+    seeds |= free_cells & (seeds >> 2);
+    free_cells &= free_cells >> 2;
+    seeds |= free_cells & (seeds >> 4);
+    free_cells &= free_cells >> 4;
+    seeds |= free_cells & (seeds >> 8);
+    free_cells &= free_cells >> 8;
+    seeds |= free_cells & (seeds >> 16);
+    free_cells &= free_cells >> 16;
+    seeds |= free_cells & (seeds >> 32);
+    return seeds;
+}
+
+/**
+ * @brief Grow the reached cells of one row over every free run that touches a seed
+ *
+ * One pass to the right and one back to the left carry the fill across word boundaries.
+ *
+ * @param row Plane row, 1 .. height
+ * @param seeds Row words, updated in place; only free bits may be set
+ * @return true if any bit was added
+ */
+bool BitboardBFS::fill_row(std::uint32_t row, std::uint64_t *seeds)
+{
+    const std::uint64_t *free_cells = this->free_plane.data() + static_cast<std::size_t>(row) * this->row_words;
+    std::uint64_t *reached = this->visited.data() + static_cast<std::size_t>(row) * this->row_words;
+    std::uint64_t carry = 0;
+    for (std::uint32_t w = 1; w <= this->words_per_row; w++)
+    {
+        seeds[w] = fill_up(seeds[w] | (carry & free_cells[w]), free_cells[w]);
+        carry = seeds[w] >> 63;
+    }
+    bool changed = false;
+    carry = 0;
+    for (std::uint32_t w = this->words_per_row; w >= 1; w--)
+    {
+        seeds[w] = fill_down(seeds[w] | ((carry << 63) & free_cells[w]), free_cells[w]);
+        carry = seeds[w] & 1;
+        changed |= seeds[w] != reached[w];
+        reached[w] = seeds[w];
+    }
+    return changed;
+}
+
+/**
+ * @brief Mark in visited every cell 4-connected to the start
+ *
+ * @param start_y
+ * @param start_x
+ * @param goal_word Plane word of the goal, -1 to fill the whole component
+ * @param goal_bit Bit of the goal inside goal_word
+ * @return true if the start is free and, when a goal is given, the goal was reached
+ */
+bool BitboardBFS::flood_fill(std::uint32_t start_y, std::uint32_t start_x, std::int64_t goal_word, std::uint64_t goal_bit)
+{
+    if (start_y >= this->height || start_x >= this->width)
+        return false;
+    std::uint32_t start_word = plane_word(start_y, start_x);
+    std::uint64_t start_bit = std::uint64_t(1) << (start_x % 64);
+    if ((this->free_plane[start_word] & start_bit) == 0)
+        return false;
+
+    std::fill(this->visited.begin(), this->visited.end(), 0);
+    this->visited[start_word] = start_bit;
+    // next_frontier is all zero between layers, so one of its rows serves as scratch
+    std::uint64_t *seeds = this->next_frontier.data();
+
+    std::copy_n(this->visited.data() + static_cast<std::size_t>(start_y + 1) * this->row_words, this->row_words, seeds);
+    fill_row(start_y + 1, seeds);
+
+    bool changed = true;
+    while (changed && (goal_word < 0 || (this->visited[goal_word] & goal_bit) == 0))
+    {
+        changed = false;
+        for (int sweep = 0; sweep < 2; sweep++)
+            for (std::uint32_t step = 0; step < this->height; step++)
+            {
+                // Down the rows, then back up, taking seeds from the row just filled
+                std::uint32_t row = sweep == 0 ? step + 1 : this->height - step;
+                std::uint32_t from_row = sweep == 0 ? row - 1 : row + 1;
+                const std::uint64_t *from = this->visited.data() + static_cast<std::size_t>(from_row) * this->row_words;
+                const std::uint64_t *reached = this->visited.data() + static_cast<std::size_t>(row) * this->row_words;
+                const std::uint64_t *free_cells = this->free_plane.data() + static_cast<std::size_t>(row) * this->row_words;
+                std::uint64_t fresh = 0;
+                for (std::uint32_t w = 1; w <= this->words_per_row; w++)
+                {
+                    seeds[w] = reached[w] | (from[w] & free_cells[w]);
+                    fresh |= seeds[w] & ~reached[w];
+                }
+                if (fresh != 0 && fill_row(row, seeds))
+                    changed = true;
+            }
+    }
+    std::fill_n(seeds, this->row_words, 0);
+    return goal_word < 0 || (this->visited[goal_word] & goal_bit) != 0;
+}
+
+/**
+ * @brief Check whether cell (y,x) belongs to a recorded frontier layer
+ *
+ * A layer's words are recorded in ascending plane order, so this is a binary search.
+ *
+ * @param layer
+ * @param y
+ * @param x
+ * @return true if the cell was first reached in that layer
+ */
+bool BitboardBFS::in_layer(std::uint32_t layer, std::uint32_t y, std::uint32_t x) const
+{
+    auto first = this->layer_word_index.begin() + this->layer_offsets[layer];
+    auto last = this->layer_word_index.begin() + this->layer_offsets[layer + 1];
+    std::uint32_t word = plane_word(y, x);
+    auto found = std::lower_bound(first, last, word);
+    if (found == last || *found != word)
+        return false;
+    return (this->layer_word_bits[found - this->layer_word_index.begin()] >> (x % 64)) & 1;
+}
+
+/**
+ * @brief Grow the wavefront from the start until the goal bit is set or the frontier dies out
+ *
+ * @param start_y
+ * @param start_x
+ * @param goal_word Plane word of the goal, -1 to flood the whole component
+ * @param goal_bit Bit of the goal inside goal_word
+ * @param record_history Keep every layer for path recovery
+ * @param distance Optional distance field, indexed like the GridMap, filled with BFS layers
+ * @return std::uint32_t Layer the goal was reached in (or the last layer when flooding),
+ *         BITBOARD_UNREACHED if the goal or the start cell is not reachable
+ */
+std::uint32_t BitboardBFS::run(std::uint32_t start_y, std::uint32_t start_x, std::int64_t goal_word, std::uint64_t goal_bit, bool record_history, std::vector<std::uint32_t> *distance)
+{
+    if (distance != nullptr)
+        distance->assign(static_cast<std::size_t>(this->height) * this->map_stride, BITBOARD_UNREACHED);
+    this->layer_word_index.clear();
+    this->layer_word_bits.clear();
+    this->layer_offsets.clear();
+
+    if (start_y >= this->height || start_x >= this->width)
+        return BITBOARD_UNREACHED;
+    std::uint32_t start_word = plane_word(start_y, start_x);
+    std::uint64_t start_bit = std::uint64_t(1) << (start_x % 64);
+    if ((this->free_plane[start_word] & start_bit) == 0)
+        return BITBOARD_UNREACHED;
+
+    // The frontier planes are all zero between queries; only visited needs a full reset
+    std::fill(this->visited.begin(), this->visited.end(), 0);
+    this->visited[start_word] = start_bit;
+    this->frontier[start_word] = start_bit;
+    std::uint32_t start_plane_x = start_word - (start_y + 1) * this->row_words;
+    this->frontier_summary[static_cast<std::size_t>(start_y + 1) * this->summary_words + start_plane_x / 64] |= std::uint64_t(1) << (start_plane_x % 64);
+    this->active_rows.push_back(start_y + 1);
+    this->layer_offsets.push_back(0);
+    if (record_history)
+    {
+        this->layer_word_index.push_back(start_word);
+        this->layer_word_bits.push_back(start_bit);
+        this->layer_offsets.push_back(1);
+    }
+    if (distance != nullptr)
+        (*distance)[static_cast<std::size_t>(start_y) * this->map_stride + start_x] = 0;
+
+    std::uint32_t layer = 0;
+    bool found = goal_word >= 0 && (this->visited[goal_word] & goal_bit) != 0;
+    while (!found && !this->active_rows.empty())
+    {
+        // Rows next to a frontier row, ascending and without duplicates
+        this->candidates.clear();
+        for (std::uint32_t row : this->active_rows)
+            for (std::uint32_t r = row - 1; r <= row + 1; r++)
+                if (r >= 1 && r <= this->height && (this->candidates.empty() || r > this->candidates.back()))
+                    this->candidates.push_back(r);
+
+        layer++;
+        this->next_rows.clear();
+        for (std::uint32_t row : this->candidates)
+        {
+            std::uint32_t *distance_row = nullptr;
+            if (distance != nullptr)
+                distance_row = distance->data() + static_cast<std::size_t>(row - 1) * this->map_stride;
+            if (expand_row(row, record_history, distance_row, layer))
+                this->next_rows.push_back(row);
+        }
+
+        // Zero the finished frontier so it can serve as the next output plane
+        clear_frontier();
+        this->frontier.swap(this->next_frontier);
+        this->frontier_summary.swap(this->next_summary);
+        this->active_rows.swap(this->next_rows);
+
+        if (record_history)
+            this->layer_offsets.push_back(this->layer_word_index.size());
+        found = goal_word >= 0 && (this->visited[goal_word] & goal_bit) != 0;
+    }
+
+    // Leave the frontier planes zeroed for the next query
+    clear_frontier();
+
+    if (goal_word < 0)
+        return layer - (layer > 0 ? 1 : 0); // The last layer expanded found nothing new
+    return found ? layer : BITBOARD_UNREACHED;
+}
+
+/**
+ * @brief 4-connected BFS distance from the start to every cell
+ *
+ * @param start_y
+ * @param start_x
+ * @param distance Resized to height * stride of the loaded map; BITBOARD_UNREACHED for cells
+ *                 that cannot be reached
+ * @return std::uint64_t Number of reachable cells, including the start
+ */
+std::uint64_t BitboardBFS::distance_field(std::uint32_t start_y, std::uint32_t start_x, std::vector<std::uint32_t> &distance)
+{
+    if (run(start_y, start_x, -1, 0, false, &distance) == BITBOARD_UNREACHED)
+        return 0;
+
+    std::uint64_t reached = 0;
+    for (std::uint64_t word : this->visited)
+        reached += __builtin_popcountll(word);
+    return reached;
+}
+
+/**
+ * @brief Count the cells 4-connected to the start, including the start
+ *
+ * @param start_y
+ * @param start_x
+ * @return std::uint64_t 0 if the start is blocked or outside the grid
+ */
+std::uint64_t BitboardBFS::component_size(std::uint32_t start_y, std::uint32_t start_x)
+{
+    if (!flood_fill(start_y, start_x, -1, 0))
+        return 0;
+
+    std::uint64_t reached = 0;
+    for (std::uint64_t word : this->visited)
+        reached += __builtin_popcountll(word);
+    return reached;
+}
+
+/**
+ * @brief Check whether the goal can be reached from the start, by flood fill
+ *
+ * @param start_y
+ * @param start_x
+ * @param goal_y
+ * @param goal_x
+ * @return true if a 4-connected path exists
+ */
+bool BitboardBFS::is_reachable(std::uint32_t start_y, std::uint32_t start_x, std::uint32_t goal_y, std::uint32_t goal_x)
+{
+    if (goal_y >= this->height || goal_x >= this->width)
+        return false;
+    return flood_fill(start_y, start_x, plane_word(goal_y, goal_x), std::uint64_t(1) << (goal_x % 64));
+}
+
+/**
+ * @brief Find a shortest 4-connected path and write it as {y, x} cells from start to goal
+ *
+ * The path is walked back from the goal through the frontier-layer history: a cell of
+ * layer k always has a neighbour in layer k - 1.
+ *
+ * @param start_y
+ * @param start_x
+ * @param goal_y
+ * @param goal_x
+ * @param path Cleared, then filled with the path cells
+ * @return std::uint32_t Number of cells on the path, 0 if the goal is unreachable
+ */
+std::uint32_t BitboardBFS::find_path(std::uint32_t start_y, std::uint32_t start_x, std::uint32_t goal_y, std::uint32_t goal_x, GridPath &path)
+{
+    path.stride = this->map_stride;
+    path.clear();
+    if (goal_y >= this->height || goal_x >= this->width)
+        return 0;
+    std::uint32_t goal_layer = run(start_y, start_x, plane_word(goal_y, goal_x), std::uint64_t(1) << (goal_x % 64), true, nullptr);
+    if (goal_layer == BITBOARD_UNREACHED)
+        return 0;
+
+    const std::int64_t dy[4] = {-1, 1, 0, 0};
+    const std::int64_t dx[4] = {0, 0, -1, 1};
+    path.cells.resize(goal_layer + 1);
+    std::uint32_t y = goal_y, x = goal_x;
+    path.cells[goal_layer] = y * this->map_stride + x;
+    for (std::uint32_t layer = goal_layer; layer > 0; layer--)
+    {
+        for (std::uint8_t dir = 0; dir < 4; dir++)
+        {
+            std::int64_t ny = static_cast<std::int64_t>(y) + dy[dir];
+            std::int64_t nx = static_cast<std::int64_t>(x) + dx[dir];
+            if (ny < 0 || nx < 0 || ny >= this->height || nx >= this->width)
+                continue;
+            if (in_layer(layer - 1, ny, nx))
+            {
+                y = ny;
+                x = nx;
+                break;
+            }
+        }
+        path.cells[layer - 1] = y * this->map_stride + x;
+    }
+    return goal_layer + 1;
+}
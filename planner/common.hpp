@@ -0,0 +1,71 @@
+/**
+ * @file common.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Grid configuration, cell markers and search tags shared by the planner library and its front-ends
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_COMMON_HPP
+#define PLANNER_COMMON_HPP
+
+#include <cstdint>
+#include <array>
+#include <chrono>
+
+#include "grid_map.hpp"
+
+/* -------------------------------------------------------------------------- */
+/*                               BASIC VARIABLES                              */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Default Grid Configuration, the grid itself is sized at runtime.
+ */
+#define GRID_WIDTH 128
+#define GRID_HEIGHT 128
+
+/* --------------------------- SEARCH TYPE MACROS --------------------------- */
+/**
+ * @brief Types of Searches
+ */
+#define RANDOM_SEARCH "Random Search"
+#define BFS_SEARCH "BFS Search"
+#define DFS_SEARCH "DFS Search"
+#define DIJKSTRA_SEARCH "Dijkstra Search"
+#define ASTAR_SEARCH "A* Search"
+#define JPS_SEARCH "JPS Search"
+#define JPS_PLUS_SEARCH "JPS+ Search"
+#define BIDIRECTIONAL_BFS_SEARCH "Bidirectional BFS Search"
+#define BIDIRECTIONAL_DIJKSTRA_SEARCH "Bidirectional Dijkstra Search"
+
+/* --------------------- SECONDARY VARIABLES AND MACROS --------------------- */
+/**
+ * @brief Value to mark each block
+ */
+#define BLOCK_EMPTY 0
+#define BLOCK_OBSTACLE 1
+#define BLOCK_VISITED 2
+
+/* ---------------------------- SEARCH STATISTICS --------------------------- */
+/**
+ * @brief Wraps hot-path statistics (counters, phase timers); build with -DPLANNER_NO_STATS to
+ * compile them out. Results such as path length, path cost or reached cells never go through it.
+ */
+#ifndef PLANNER_NO_STATS
+#define PLANNER_STAT(...) __VA_ARGS__
+#else
+#define PLANNER_STAT(...) ((void)0)
+#endif
+
+/**
+ * @brief Nanoseconds since begin on the monotonic clock
+ */
+inline std::uint64_t elapsed_ns(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+#endif // PLANNER_COMMON_HPP
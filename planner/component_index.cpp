@@ -0,0 +1,327 @@
+/**
+ * @file component_index.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Connected components of the free cells, for O(1) reachability checks
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "component_index.hpp"
+#include "common.hpp"
+
+#include <stdexcept>
+
+/**
+ * @brief Ring of the 8 neighbours in clockwise order from north; straight moves at even slots
+ */
+static const int RING_DY[8] = {-1, -1, 0, 1, 1, 1, 0, -1};
+static const int RING_DX[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+/**
+ * @brief Construct an empty index; build() it before use
+ *
+ * @param connectivity 4 -> straight moves only (BFS, DFS), 8 -> straight and diagonal moves (Dijkstra, A*, JPS)
+ * @throw std::invalid_argument for any other connectivity
+ */
+ComponentIndex::ComponentIndex(std::uint8_t connectivity)
+{
+    if (connectivity != 4 && connectivity != 8)
+        throw std::invalid_argument("Connectivity must be 4 or 8");
+    this->connectivity = connectivity;
+    this->map = nullptr;
+    this->version = 0;
+    this->stale = true;
+    this->stride = 0;
+    this->components = 0;
+}
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Root of a free cell, read-only so lookups can run concurrently
+ */
+std::uint32_t ComponentIndex::find(std::uint32_t cell) const
+{
+    while (this->parent[cell] != cell)
+        cell = this->parent[cell];
+    return cell;
+}
+
+/**
+ * @brief Root of a free cell, halving the path on the way up
+ */
+std::uint32_t ComponentIndex::compress(std::uint32_t cell)
+{
+    while (this->parent[cell] != cell)
+    {
+        this->parent[cell] = this->parent[this->parent[cell]];
+        cell = this->parent[cell];
+    }
+    return cell;
+}
+
+/**
+ * @brief Merge the components of two free cells, the smaller one below the larger one
+ */
+void ComponentIndex::unite(std::uint32_t a, std::uint32_t b)
+{
+    std::uint32_t root_a = compress(a);
+    std::uint32_t root_b = compress(b);
+    if (root_a == root_b)
+        return;
+    if (this->cells[root_a] < this->cells[root_b])
+        std::swap(root_a, root_b);
+    this->parent[root_b] = root_a;
+    this->cells[root_a] += this->cells[root_b];
+    this->components--;
+}
+
+/**
+ * @brief Unite a free cell with its free neighbours
+ *
+ * @param map
+ * @param y
+ * @param x
+ * @param all_sides False -> only the neighbours a row-major scan has already visited
+ */
+void ComponentIndex::unite_with_neighbours(const GridMap &map, std::uint32_t y, std::uint32_t x, bool all_sides)
+{
+    std::uint32_t cell = y * this->stride + x;
+    for (std::uint8_t slot = 0; slot < 8; slot++)
+    {
+        if (this->connectivity == 4 && slot % 2 == 1)
+            continue;
+        // Visited by the scan: the row above and the cell to the left
+        if (!all_sides && RING_DY[slot] == 1)
+            continue;
+        if (!all_sides && RING_DY[slot] == 0 && RING_DX[slot] == 1)
+            continue;
+
+        std::int64_t neighbour_y = static_cast<std::int64_t>(y) + RING_DY[slot];
+        std::int64_t neighbour_x = static_cast<std::int64_t>(x) + RING_DX[slot];
+        if (!map.in_bounds(neighbour_y, neighbour_x) || map.at(neighbour_y, neighbour_x) == BLOCK_OBSTACLE)
+            continue;
+        unite(cell, neighbour_y * this->stride + neighbour_x);
+    }
+}
+
+/**
+ * @brief Check whether blocking a cell could split its component
+ *
+ * The free neighbours of the cell stay connected if they are joined around the ring of the 8
+ * neighbours without passing through the cell. Only when they form more than one group may the
+ * component fall apart, which the local view cannot decide.
+ *
+ * @param map Map before the cell is blocked
+ * @param y
+ * @param x
+ */
+bool ComponentIndex::may_split(const GridMap &map, std::uint32_t y, std::uint32_t x) const
+{
+    bool free[8];
+    for (std::uint8_t slot = 0; slot < 8; slot++)
+    {
+        std::int64_t ring_y = static_cast<std::int64_t>(y) + RING_DY[slot];
+        std::int64_t ring_x = static_cast<std::int64_t>(x) + RING_DX[slot];
+        free[slot] = map.in_bounds(ring_y, ring_x) && map.at(ring_y, ring_x) != BLOCK_OBSTACLE;
+    }
+
+    // Label groups of the ring: consecutive slots touch; with diagonal moves so do the straight slots around a corner
+    std::uint8_t group[8];
+    for (std::uint8_t slot = 0; slot < 8; slot++)
+        group[slot] = slot;
+    auto join = [&](std::uint8_t a, std::uint8_t b)
+    {
+        std::uint8_t from = group[b], to = group[a];
+        for (std::uint8_t slot = 0; slot < 8; slot++)
+            if (group[slot] == from)
+                group[slot] = to;
+    };
+    for (std::uint8_t slot = 0; slot < 8; slot++)
+    {
+        std::uint8_t next = (slot + 1) % 8;
+        if (free[slot] && free[next])
+            join(slot, next);
+        if (this->connectivity == 8 && slot % 2 == 0 && free[slot] && free[(slot + 2) % 8])
+            join(slot, (slot + 2) % 8);
+    }
+
+    // Neighbours of the cell under the connectivity must all share one group
+    std::int16_t seen = -1;
+    for (std::uint8_t slot = 0; slot < 8; slot++)
+    {
+        if (!free[slot] || (this->connectivity == 4 && slot % 2 == 1))
+            continue;
+        if (seen >= 0 && group[slot] != seen)
+            return true;
+        seen = group[slot];
+    }
+    return false;
+}
+
+/* ------------------------------ INDEX BUILD ------------------------------- */
+/**
+ * @brief Label every free cell of the map
+ *
+ * @param map Map to label, must outlive the index
+ */
+void ComponentIndex::build(const GridMap &map)
+{
+    this->map = &map;
+    this->stride = map.get_stride();
+    this->parent.assign(map.cell_count(), NO_COMPONENT);
+    this->cells.assign(map.cell_count(), 0);
+    this->components = 0;
+
+    const std::uint8_t *grid = map.data();
+    for (std::uint32_t y = 0; y < map.get_height(); y++)
+        for (std::uint32_t x = 0; x < map.get_width(); x++)
+        {
+            std::uint32_t cell = y * this->stride + x;
+            if (grid[cell] == BLOCK_OBSTACLE)
+                continue;
+            this->parent[cell] = cell;
+            this->cells[cell] = 1;
+            this->components++;
+            unite_with_neighbours(map, y, x, false);
+        }
+
+    // Point every cell straight at its root
+    for (std::uint32_t cell = 0; cell < map.cell_count(); cell++)
+        if (this->parent[cell] != NO_COMPONENT)
+            this->parent[cell] = compress(cell);
+
+    this->version = map.get_version();
+    this->stale = false;
+}
+
+/**
+ * @brief Rebuild the index if the map changed since the last build or edit
+ *
+ * @param map
+ * @return true if the index was rebuilt
+ */
+bool ComponentIndex::refresh(const GridMap &map)
+{
+    if (is_current(map))
+        return false;
+    build(map);
+    return true;
+}
+
+/**
+ * @brief Check whether the labels describe the map as it is now
+ *
+ * @param map
+ */
+bool ComponentIndex::is_current(const GridMap &map) const
+{
+    return !this->stale && this->map == &map && this->version == map.get_version();
+}
+
+/* ------------------------------- MAP EDITS -------------------------------- */
+/**
+ * @brief Free a cell of the map and merge the components around it
+ *
+ * @param map Map of the last build
+ * @param y 0-based
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the map
+ */
+void ComponentIndex::free_cell(GridMap &map, std::uint32_t y, std::uint32_t x)
+{
+    if (!map.in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    if (map.at(y, x) != BLOCK_OBSTACLE)
+        return;
+
+    bool current = is_current(map);
+    map.at(y, x) = BLOCK_EMPTY;
+    map.mark_modified();
+    if (!current)
+        return;
+
+    std::uint32_t cell = y * this->stride + x;
+    if (this->parent[cell] != NO_COMPONENT)
+    {
+        // Still linked into the component it was blocked out of, which it may no longer touch
+        this->stale = true;
+        return;
+    }
+    this->parent[cell] = cell;
+    this->cells[cell] = 1;
+    this->components++;
+    unite_with_neighbours(map, y, x, true);
+    this->version = map.get_version();
+}
+
+/**
+ * @brief Block a cell of the map and take it out of its component
+ *
+ * @param map Map of the last build
+ * @param y 0-based
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the map
+ */
+void ComponentIndex::block_cell(GridMap &map, std::uint32_t y, std::uint32_t x)
+{
+    if (!map.in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    if (map.at(y, x) == BLOCK_OBSTACLE)
+        return;
+
+    bool current = is_current(map) && !may_split(map, y, x);
+    map.at(y, x) = BLOCK_OBSTACLE;
+    map.mark_modified();
+    if (!current)
+    {
+        this->stale = true;
+        return;
+    }
+
+    // The cell stays in the forest as an inner node, only its count leaves the component
+    std::uint32_t root = compress(y * this->stride + x);
+    if (--this->cells[root] == 0)
+        this->components--;
+    this->version = map.get_version();
+}
+
+/* -------------------------------- LOOKUPS --------------------------------- */
+/**
+ * @brief Label of the component holding a cell
+ *
+ * @param y 0-based
+ * @param x 0-based
+ * @return std::uint32_t NO_COMPONENT for obstacles and cells outside the map
+ */
+std::uint32_t ComponentIndex::component_of(std::uint32_t y, std::uint32_t x) const
+{
+    if (!this->map->in_bounds(y, x) || this->map->at(y, x) == BLOCK_OBSTACLE)
+        return NO_COMPONENT;
+    return find(y * this->stride + x);
+}
+
+/**
+ * @brief Number of free cells connected to a cell, itself included
+ *
+ * @param y 0-based
+ * @param x 0-based
+ * @return std::uint32_t 0 for obstacles and cells outside the map
+ */
+std::uint32_t ComponentIndex::component_size(std::uint32_t y, std::uint32_t x) const
+{
+    std::uint32_t component = component_of(y, x);
+    return (component == NO_COMPONENT) ? 0 : this->cells[component];
+}
+
+/**
+ * @brief Check whether a path joins two cells
+ *
+ * @return true if both cells are free and in the same component
+ */
+bool ComponentIndex::connected(std::uint32_t from_y, std::uint32_t from_x, std::uint32_t to_y, std::uint32_t to_x) const
+{
+    std::uint32_t from = component_of(from_y, from_x);
+    return (from != NO_COMPONENT) && (from == component_of(to_y, to_x));
+}
@@ -0,0 +1,69 @@
+/**
+ * @file component_index.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Connected components of the free cells, for O(1) reachability checks
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_COMPONENT_INDEX_HPP
+#define PLANNER_COMPONENT_INDEX_HPP
+
+#include "grid_map.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#define NO_COMPONENT UINT32_MAX
+
+/* ------------------------- COMPONENT INDEX CLASS -------------------------- */
+/**
+ * @brief Union-find labeling of the free cells of a map, 4- or 8-connected
+ *
+ * build() unites every free cell with its free neighbours above and to the left in one scan and
+ * flattens the forest, so a label lookup is a single read. The index remembers the map version it
+ * was built for and is only trusted while the map is unchanged.
+ *
+ * free_cell() / block_cell() edit the map at 0-based cells, like every map edit of the planners
+ * (DStarLite, HpaStar), and keep the index current: a freed cell joins the components around it,
+ * and a blocked cell whose free neighbours stay connected around it only leaves its component. A
+ * block that may split a component leaves the index stale until the next refresh().
+ *
+ * Lookups are const and may run from many threads; builds and edits may not overlap them.
+ */
+class ComponentIndex
+{
+private:
+    std::uint8_t connectivity;          // 4 or 8
+    const GridMap *map;                 // Map of the last build
+    std::uint64_t version;              // Map version the labels are valid for
+    bool stale;                         // An edit may have split a component
+    std::uint32_t stride;
+    std::vector<std::uint32_t> parent;  // Union-find parent, NO_COMPONENT for obstacles
+    std::vector<std::uint32_t> cells;   // Free cells of a component, valid at the roots
+    std::uint32_t components;           // Number of components
+
+    std::uint32_t find(std::uint32_t cell) const;
+    std::uint32_t compress(std::uint32_t cell);
+    void unite(std::uint32_t a, std::uint32_t b);
+    void unite_with_neighbours(const GridMap &map, std::uint32_t y, std::uint32_t x, bool all_sides);
+    bool may_split(const GridMap &map, std::uint32_t y, std::uint32_t x) const;
+
+public:
+    explicit ComponentIndex(std::uint8_t connectivity = 4);
+    void build(const GridMap &map);
+    bool refresh(const GridMap &map);
+    bool is_current(const GridMap &map) const;
+    void free_cell(GridMap &map, std::uint32_t y, std::uint32_t x);
+    void block_cell(GridMap &map, std::uint32_t y, std::uint32_t x);
+
+    std::uint8_t get_connectivity(void) const { return connectivity; }
+    std::uint32_t component_count(void) const { return components; }
+    std::uint32_t component_of(std::uint32_t y, std::uint32_t x) const;
+    std::uint32_t component_size(std::uint32_t y, std::uint32_t x) const;
+    bool connected(std::uint32_t from_y, std::uint32_t from_x, std::uint32_t to_y, std::uint32_t to_x) const;
+};
+
+#endif // PLANNER_COMPONENT_INDEX_HPP
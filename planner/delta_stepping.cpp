@@ -0,0 +1,257 @@
+/**
+ * @file delta_stepping.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Delta-stepping single-source shortest paths on the weighted 8-connected grid
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "delta_stepping.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Work split of one round
+ */
+#define ROUND_CHUNK 1024  // Cells per relaxation task
+#define ROWS_PER_TASK 64  // Grid rows per initialization task
+
+#define NOT_QUEUED UINT32_MAX
+
+/**
+ * @brief Largest bucket storage kept in the pool; bigger buckets go to the heap on every search
+ */
+#define BUCKET_POOL_BLOCK (std::size_t(1) << 22)
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/**
+ * @brief Construct the engine and its thread pool
+ *
+ * @param map Map to search, must outlive the engine and stay unchanged during a search
+ * @param thread_count Workers including the calling thread, 0 -> one per hardware thread
+ */
+DeltaStepping::DeltaStepping(const GridMap &map, std::uint32_t thread_count)
+    : pool(thread_count), bucket_memory(std::pmr::pool_options{0, BUCKET_POOL_BLOCK}), buckets(&bucket_memory)
+{
+    this->map = &map;
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->cell_total = 0;
+    this->delta = 0;
+    this->lowered.resize(this->pool.size());
+}
+
+/**
+ * @brief Set the price of straight and diagonal moves
+ *
+ * @param move_costs Positive straight and diagonal move costs
+ */
+void DeltaStepping::set_move_costs(MoveCosts move_costs)
+{
+    this->move_costs = move_costs;
+}
+
+/**
+ * @brief Set the bucket width
+ *
+ * @param delta Positive width, 0 -> the straight move cost (straight moves light, diagonals heavy)
+ * @throw std::invalid_argument if delta is negative
+ */
+void DeltaStepping::set_delta(double delta)
+{
+    if (delta < 0)
+        throw std::invalid_argument("Delta must not be negative");
+    this->delta = delta;
+}
+
+/**
+ * @brief Read the dimensions of the map and size the per-cell buffers for it
+ */
+void DeltaStepping::bind_grid(void)
+{
+    this->width = this->map->get_width();
+    this->height = this->map->get_height();
+    this->stride = this->map->get_stride();
+
+    std::size_t cells = this->map->cell_count();
+    if (cells != this->cell_total)
+    {
+        this->cost.reset(new std::atomic<double>[cells]);
+        this->queued_in.resize(cells);
+        this->cell_total = cells;
+    }
+}
+
+/**
+ * @brief Relax the light or the heavy moves of every cell in from, in parallel
+ *
+ * @param from Cells to relax, each at most once
+ * @param light True -> moves costing at most width, False -> the others
+ * @param width Bucket width
+ */
+void DeltaStepping::relax_round(const std::vector<std::uint32_t> &from, bool light, double width)
+{
+    const double move_cost[8] = {this->move_costs.straight, this->move_costs.straight, this->move_costs.straight, this->move_costs.straight,
+                                 this->move_costs.diagonal, this->move_costs.diagonal, this->move_costs.diagonal, this->move_costs.diagonal};
+    const std::uint8_t *cells = this->map->data();
+
+    std::size_t chunks = (from.size() + ROUND_CHUNK - 1) / ROUND_CHUNK;
+    this->pool.parallel_for(chunks, [&](std::uint32_t worker, std::size_t chunk)
+                            {
+        std::vector<std::uint32_t> &found = this->lowered[worker];
+        std::size_t first = chunk * ROUND_CHUNK;
+        std::size_t last = std::min(first + ROUND_CHUNK, from.size());
+        for (std::size_t item = first; item < last; item++)
+        {
+            std::uint32_t cell = from[item];
+            double distance = this->cost[cell].load(std::memory_order_relaxed);
+            std::int64_t y = cell / this->stride;
+            std::int64_t x = cell % this->stride;
+            for (std::uint8_t dir = 0; dir < 8; dir++)
+            {
+                if ((move_cost[dir] <= width) != light)
+                    continue;
+                std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+                std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+                if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                    continue;
+                std::uint32_t neighbour = neighbour_y * this->stride + neighbour_x;
+                if (cells[neighbour] == BLOCK_OBSTACLE)
+                    continue;
+
+                // Lower the cost unless another worker got it lower first
+                double through = distance + move_cost[dir];
+                double current = this->cost[neighbour].load(std::memory_order_relaxed);
+                while (through < current)
+                {
+                    if (this->cost[neighbour].compare_exchange_weak(current, through, std::memory_order_relaxed))
+                    {
+                        found.push_back(neighbour);
+                        break;
+                    }
+                }
+            }
+        } });
+}
+
+/**
+ * @brief Queue every cell lowered in the last round into the bucket of its new cost
+ *
+ * A cell already queued in that bucket is not queued twice; its entry in an older, later bucket
+ * goes stale and is skipped when that bucket is reached.
+ *
+ * @param width Bucket width
+ * @param lowest First bucket still open, guards against rounding just below a bucket boundary
+ */
+void DeltaStepping::gather_lowered(double width, std::uint32_t lowest)
+{
+    for (std::vector<std::uint32_t> &found : this->lowered)
+    {
+        PLANNER_STAT(this->stats.relaxations += found.size());
+        for (std::uint32_t cell : found)
+        {
+            std::uint32_t bucket = std::max(lowest, static_cast<std::uint32_t>(this->cost[cell].load(std::memory_order_relaxed) / width));
+            if (this->queued_in[cell] == bucket)
+                continue;
+            this->queued_in[cell] = bucket;
+            if (bucket >= this->buckets.size())
+                this->buckets.resize(bucket + 1);
+            this->buckets[bucket].push_back(cell);
+        }
+        found.clear();
+    }
+}
+
+/**
+ * @brief 8-connected cost from the source to every cell
+ *
+ * @param source_y 0-based
+ * @param source_x 0-based
+ * @param field Resized to height * stride of the map; DELTA_STEPPING_UNREACHED for cells that cannot
+ *              be reached
+ * @return std::uint64_t Number of reachable cells, including the source; 0 if the source is blocked
+ *                       or outside the map
+ */
+std::uint64_t DeltaStepping::cost_field(std::uint32_t source_y, std::uint32_t source_x, std::vector<double> &field)
+{
+    bind_grid();
+    this->stats = DeltaSteppingStats();
+    double width = (this->delta > 0) ? this->delta : this->move_costs.straight;
+    field.assign(this->cell_total, DELTA_STEPPING_UNREACHED);
+    if (!this->map->in_bounds(source_y, source_x) || this->map->at(source_y, source_x) == BLOCK_OBSTACLE)
+        return 0;
+
+    std::size_t blocks = (this->height + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+    this->pool.parallel_for(blocks, [&](std::uint32_t, std::size_t block)
+                            {
+        std::size_t first = block * ROWS_PER_TASK * static_cast<std::size_t>(this->stride);
+        std::size_t last = std::min<std::size_t>(first + ROWS_PER_TASK * static_cast<std::size_t>(this->stride), this->cell_total);
+        for (std::size_t cell = first; cell < last; cell++)
+        {
+            this->cost[cell].store(DELTA_STEPPING_UNREACHED, std::memory_order_relaxed);
+            this->queued_in[cell] = NOT_QUEUED;
+        } });
+
+    std::uint32_t source = source_y * this->stride + source_x;
+    this->cost[source].store(0, std::memory_order_relaxed);
+    this->queued_in[source] = 0;
+    this->buckets.resize(1);
+    this->buckets[0].push_back(source);
+
+    for (std::uint32_t bucket = 0; bucket < this->buckets.size(); bucket++)
+    {
+        if (this->buckets[bucket].empty())
+            continue;
+        PLANNER_STAT(this->stats.buckets++);
+        this->settled.clear();
+
+        // Light rounds until the bucket stays empty
+        while (!this->buckets[bucket].empty())
+        {
+            this->round.clear();
+            for (std::uint32_t cell : this->buckets[bucket])
+            {
+                if (this->queued_in[cell] != bucket)
+                {
+                    PLANNER_STAT(this->stats.stale_entries++);
+                    continue; // Stale or duplicate entry
+                }
+                this->queued_in[cell] = NOT_QUEUED;
+                this->round.push_back(cell);
+            }
+            this->buckets[bucket].clear();
+            this->settled.insert(this->settled.end(), this->round.begin(), this->round.end());
+
+            relax_round(this->round, true, width);
+            PLANNER_STAT(this->stats.light_phases++);
+            gather_lowered(width, bucket);
+        }
+        this->buckets[bucket].shrink_to_fit(); // Settled for good, hand the memory back to the pool
+
+        // Heavy moves once per settled cell; a cell relaxed in several rounds is listed more than once
+        std::sort(this->settled.begin(), this->settled.end());
+        this->settled.erase(std::unique(this->settled.begin(), this->settled.end()), this->settled.end());
+        relax_round(this->settled, false, width);
+        gather_lowered(width, bucket + 1);
+        this->stats.cells_reached += this->settled.size();
+    }
+    this->buckets.clear(); // Bucket storage stays in bucket_memory for the next search
+
+    this->pool.parallel_for(blocks, [&](std::uint32_t, std::size_t block)
+                            {
+        std::size_t first = block * ROWS_PER_TASK * static_cast<std::size_t>(this->stride);
+        std::size_t last = std::min<std::size_t>(first + ROWS_PER_TASK * static_cast<std::size_t>(this->stride), this->cell_total);
+        for (std::size_t cell = first; cell < last; cell++)
+            field[cell] = this->cost[cell].load(std::memory_order_relaxed); });
+    return this->stats.cells_reached;
+}
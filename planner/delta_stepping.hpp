@@ -0,0 +1,84 @@
+/**
+ * @file delta_stepping.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Delta-stepping single-source shortest paths on the weighted 8-connected grid
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_DELTA_STEPPING_HPP
+#define PLANNER_DELTA_STEPPING_HPP
+
+#include "grid_map.hpp"
+#include "start_search.hpp"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#define DELTA_STEPPING_UNREACHED std::numeric_limits<double>::infinity()
+
+/**
+ * @brief How the last cost field was computed
+ */
+struct DeltaSteppingStats
+{
+    std::uint32_t buckets = 0;       // Non-empty buckets settled
+    std::uint32_t light_phases = 0;  // Parallel light-edge rounds, at least one per bucket
+    std::uint64_t relaxations = 0;   // Moves that lowered a cost, re-relaxations included
+    std::uint64_t stale_entries = 0; // Bucket entries skipped because the cell moved to a lower bucket
+    std::uint64_t cells_reached = 0; // Cells with a finite cost, the source included
+};
+
+/* -------------------------- DELTA STEPPING CLASS -------------------------- */
+/**
+ * @brief Meyer and Sanders' delta-stepping over a thread pool, a parallel stand-in for dijkstra_search
+ *
+ * Cells are kept in buckets of width delta by tentative cost. The lowest bucket is settled in
+ * rounds: its cells relax their light moves (cost <= delta) in parallel, which may refill the same
+ * bucket, until it stays empty; then every cell settled in it relaxes its heavy moves (cost > delta)
+ * once, which can only reach later buckets. Costs are lowered with an atomic compare-and-swap, so
+ * workers never lock a cell.
+ *
+ * A small delta approaches Dijkstra (few re-relaxations, many short rounds), a large one approaches
+ * Bellman-Ford (long parallel rounds, more re-relaxations). The moves and their prices are those of
+ * DIJKSTRA_SEARCH, so the costs equal its path costs. Moves are symmetric, so the field from a goal
+ * is the cost-to-go of every cell.
+ */
+class DeltaStepping
+{
+private:
+    const GridMap *map;
+    ThreadPool pool;
+    std::uint32_t width, height, stride;
+    std::size_t cell_total;
+    MoveCosts move_costs;
+    double delta;                                           // Bucket width, 0 -> the straight move cost
+    std::unique_ptr<std::atomic<double>[]> cost;            // Tentative cost of every cell
+    std::vector<std::uint32_t> queued_in;                   // Bucket a cell is queued in, touched only between rounds
+    std::pmr::unsynchronized_pool_resource bucket_memory;   // Recycles the storage of settled buckets across searches
+    std::pmr::vector<std::pmr::vector<std::uint32_t>> buckets; // Cells by floor(cost / delta), may hold stale entries
+    std::vector<std::uint32_t> round;                       // Cells relaxing in the running round
+    std::vector<std::uint32_t> settled;                     // Cells settled in the running bucket
+    std::vector<std::vector<std::uint32_t>> lowered;        // Cells whose cost each worker lowered
+    DeltaSteppingStats stats;
+
+    void bind_grid(void);
+    void relax_round(const std::vector<std::uint32_t> &from, bool light, double width);
+    void gather_lowered(double width, std::uint32_t lowest);
+
+public:
+    explicit DeltaStepping(const GridMap &map, std::uint32_t thread_count = 0);
+    void set_move_costs(MoveCosts move_costs);
+    void set_delta(double delta);
+    std::uint64_t cost_field(std::uint32_t source_y, std::uint32_t source_x, std::vector<double> &field);
+    const DeltaSteppingStats &get_stats(void) const { return stats; }
+};
+
+#endif // PLANNER_DELTA_STEPPING_HPP
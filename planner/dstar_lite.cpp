@@ -0,0 +1,439 @@
+/**
+ * @file dstar_lite.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief D* Lite incremental replanning on a map whose obstacles change between queries
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "dstar_lite.hpp"
+#include "common.hpp"
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#define INFINITE_COST std::numeric_limits<double>::infinity()
+
+/**
+ * @brief Relative slack when comparing a queued key against the key of the start
+ */
+#define KEY_TOLERANCE 1e-9
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/**
+ * @brief Construct a planner on map; call reset() before the first plan()
+ *
+ * @param map Map to plan on, must outlive the planner
+ */
+DStarLite::DStarLite(GridMap &map)
+{
+    this->map = &map;
+    this->stride = 0;
+    this->start = 0;
+    this->goal = 0;
+    this->last_start = 0;
+    this->key_offset = 0;
+    this->latency_histogram = nullptr;
+}
+
+/**
+ * @brief Set the price of straight and diagonal moves; takes effect at the next reset()
+ *
+ * @param move_costs Positive straight and diagonal move costs
+ */
+void DStarLite::set_move_costs(MoveCosts move_costs)
+{
+    this->move_costs = move_costs;
+}
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Cell index of a 1-based position
+ *
+ * @throw std::out_of_range if the position lies outside the grid
+ */
+std::uint32_t DStarLite::to_cell(std::uint32_t y, std::uint32_t x) const
+{
+    if (!this->map->in_bounds(static_cast<std::int64_t>(y) - 1, static_cast<std::int64_t>(x) - 1))
+        throw std::out_of_range("Position outside the grid");
+    return (y - 1) * this->stride + (x - 1);
+}
+
+/**
+ * @brief Octile lower bound of the cost between two cells
+ *
+ * A diagonal is never priced above two straight moves, which keeps the bound admissible and
+ * consistent for any positive move costs with diagonal >= straight.
+ */
+double DStarLite::heuristic(std::uint32_t from, std::uint32_t to) const
+{
+    std::uint32_t dy = std::abs(static_cast<std::int64_t>(from / this->stride) - static_cast<std::int64_t>(to / this->stride));
+    std::uint32_t dx = std::abs(static_cast<std::int64_t>(from % this->stride) - static_cast<std::int64_t>(to % this->stride));
+    double diagonal = std::min(this->move_costs.diagonal, 2 * this->move_costs.straight);
+    return this->move_costs.straight * (dx + dy) + (diagonal - 2 * this->move_costs.straight) * std::min(dx, dy);
+}
+
+/**
+ * @brief Queue key of a cell for the current start
+ */
+DStarKey DStarLite::calculate_key(std::uint32_t cell) const
+{
+    double best = std::min(this->g[cell], this->rhs[cell]);
+    return DStarKey{best + heuristic(this->start, cell) + this->key_offset, best};
+}
+
+/**
+ * @brief Cheapest move plus cost-to-goal over the neighbours of a cell
+ *
+ * @return double INFINITE_COST for obstacles and cells without a reachable neighbour
+ */
+double DStarLite::lookahead(std::uint32_t cell) const
+{
+    const std::uint8_t *cells = this->map->data();
+    if (cells[cell] == BLOCK_OBSTACLE)
+        return INFINITE_COST;
+
+    std::int64_t y = cell / this->stride;
+    std::int64_t x = cell % this->stride;
+    double best = INFINITE_COST;
+    for (std::uint8_t dir = 0; dir < 8; dir++)
+    {
+        std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+        std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+        if (!this->map->in_bounds(neighbour_y, neighbour_x))
+            continue;
+        std::uint32_t neighbour = neighbour_y * this->stride + neighbour_x;
+        if (cells[neighbour] == BLOCK_OBSTACLE)
+            continue;
+        double move = (dir < 4) ? this->move_costs.straight : this->move_costs.diagonal;
+        best = std::min(best, move + this->g[neighbour]);
+    }
+    return best;
+}
+
+/**
+ * @brief Queue a cell while it is inconsistent, drop it from the queue once it is consistent
+ */
+void DStarLite::update_vertex(std::uint32_t cell)
+{
+    bool queued = this->open_list.contains(cell);
+    if (this->g[cell] != this->rhs[cell])
+    {
+        if (queued)
+        {
+            this->open_list.update_key(cell, calculate_key(cell));
+            PLANNER_STAT(this->stats.decrease_keys++);
+        }
+        else
+        {
+            this->open_list.push(cell, calculate_key(cell));
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+    }
+    else if (queued)
+        this->open_list.remove(cell);
+}
+
+/**
+ * @brief Recompute rhs of a cell and its neighbours after the cell turned free or blocked
+ *
+ * Every move into or out of the cell changed price, so the lookahead of each cell at either end
+ * of such a move is rebuilt.
+ */
+void DStarLite::update_around(std::uint32_t cell)
+{
+    std::int64_t y = cell / this->stride;
+    std::int64_t x = cell % this->stride;
+    for (std::int8_t dir = -1; dir < 8; dir++)
+    {
+        std::int64_t around_y = (dir < 0) ? y : y + NEIGHBOUR_DY[dir];
+        std::int64_t around_x = (dir < 0) ? x : x + NEIGHBOUR_DX[dir];
+        if (!this->map->in_bounds(around_y, around_x))
+            continue;
+        std::uint32_t around = around_y * this->stride + around_x;
+        if (around != this->goal)
+            this->rhs[around] = lookahead(around);
+        update_vertex(around);
+    }
+}
+
+/**
+ * @brief Check whether a queued key still has to be processed before the start is final
+ *
+ * Keys of cells on equally short paths tie with the key of the start, but the diagonal costs
+ * are irrational: sums of the same costs in another order, and keys queued before the start
+ * moved, can round to either side of the start key. Every near tie is therefore processed,
+ * otherwise an out of date cell may be left on the path.
+ *
+ * @param key Key of the top queued cell
+ * @param start_key Key of the start
+ */
+bool DStarLite::is_before_start(const DStarKey &key, const DStarKey &start_key) const
+{
+    if (key < start_key)
+        return true;
+    return key.primary <= start_key.primary + KEY_TOLERANCE * std::max(1.0, std::fabs(start_key.primary));
+}
+
+/* ---------------------------- SEARCH FUNCTION ---------------------------- */
+/**
+ * @brief Settle inconsistent cells until the start is consistent and no queued key is below its key
+ */
+void DStarLite::compute_shortest_path(void)
+{
+    const std::uint8_t *cells = this->map->data();
+    while (!this->open_list.empty() &&
+           (is_before_start(this->open_list.top_key(), calculate_key(this->start)) || this->rhs[this->start] > this->g[this->start]))
+    {
+        std::uint32_t cell = this->open_list.top();
+        DStarKey old_key = this->open_list.top_key();
+        DStarKey new_key = calculate_key(cell);
+        PLANNER_STAT(this->stats.nodes_expanded++);
+        PLANNER_STAT(this->stats.peak_frontier = std::max(this->stats.peak_frontier, this->open_list.size()));
+
+        // Queued before the start moved: only reorder
+        if (old_key < new_key)
+        {
+            PLANNER_STAT(this->stats.stale_pops++);
+            this->open_list.update_key(cell, new_key);
+            continue;
+        }
+
+        std::int64_t y = cell / this->stride;
+        std::int64_t x = cell % this->stride;
+        if (this->g[cell] > this->rhs[cell])
+        {
+            // Overconsistent: the cost-to-goal dropped and is final, pass it on
+            this->g[cell] = this->rhs[cell];
+            this->open_list.remove(cell);
+            PLANNER_STAT(this->stats.nodes_settled++);
+            if (cells[cell] == BLOCK_OBSTACLE)
+                continue;
+            for (std::uint8_t dir = 0; dir < 8; dir++)
+            {
+                std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+                std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+                if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                    continue;
+                std::uint32_t neighbour = neighbour_y * this->stride + neighbour_x;
+                if (neighbour == this->goal || cells[neighbour] == BLOCK_OBSTACLE)
+                    continue;
+                double move = (dir < 4) ? this->move_costs.straight : this->move_costs.diagonal;
+                if (move + this->g[cell] < this->rhs[neighbour])
+                {
+                    this->rhs[neighbour] = move + this->g[cell];
+                    update_vertex(neighbour);
+                }
+            }
+        }
+        else
+        {
+            // Underconsistent: the cost-to-goal rose, so every cell that relied on it looks again
+            double old_g = this->g[cell];
+            this->g[cell] = INFINITE_COST;
+            if (cell != this->goal)
+                this->rhs[cell] = lookahead(cell);
+            update_vertex(cell);
+            if (cells[cell] == BLOCK_OBSTACLE)
+                continue;
+            for (std::uint8_t dir = 0; dir < 8; dir++)
+            {
+                std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+                std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+                if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                    continue;
+                std::uint32_t neighbour = neighbour_y * this->stride + neighbour_x;
+                if (neighbour == this->goal || cells[neighbour] == BLOCK_OBSTACLE)
+                    continue;
+                double move = (dir < 4) ? this->move_costs.straight : this->move_costs.diagonal;
+                if (this->rhs[neighbour] == move + old_g)
+                {
+                    this->rhs[neighbour] = lookahead(neighbour);
+                    update_vertex(neighbour);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Follow the cheapest move + g from the start down to the goal
+ *
+ * @return std::uint32_t Number of cells on the path, 0 if the goal cannot be reached
+ */
+std::uint32_t DStarLite::extract_path(void)
+{
+    this->path.stride = this->stride;
+    this->path.clear();
+    if (this->g[this->start] == INFINITE_COST && this->rhs[this->start] == INFINITE_COST)
+        return 0;
+
+    const std::uint8_t *cells = this->map->data();
+    std::uint32_t cell = this->start;
+    double cost = 0;
+    this->path.cells.push_back(cell);
+    while (cell != this->goal)
+    {
+        std::int64_t y = cell / this->stride;
+        std::int64_t x = cell % this->stride;
+        std::uint32_t next = cell;
+        double best = INFINITE_COST, best_move = 0;
+        for (std::uint8_t dir = 0; dir < 8; dir++)
+        {
+            std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+            if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                continue;
+            std::uint32_t neighbour = neighbour_y * this->stride + neighbour_x;
+            if (cells[neighbour] == BLOCK_OBSTACLE)
+                continue;
+            double move = (dir < 4) ? this->move_costs.straight : this->move_costs.diagonal;
+            if (move + this->g[neighbour] < best)
+            {
+                best = move + this->g[neighbour];
+                best_move = move;
+                next = neighbour;
+            }
+        }
+
+        // A consistent start never runs into a dead end or a loop; guard the walk anyway
+        if (best == INFINITE_COST || this->path.size() > this->map->cell_count())
+        {
+            this->path.clear();
+            return 0;
+        }
+        cost += best_move;
+        cell = next;
+        this->path.cells.push_back(cell);
+    }
+
+    this->stats.path_cost = cost;
+    return this->path.size();
+}
+
+/**
+ * @brief Start over: forget the search tree and plan from start to end on the current map
+ *
+ * @param start_position_y 1-based
+ * @param start_position_x 1-based
+ * @param end_position_y 1-based
+ * @param end_position_x 1-based
+ * @throw std::out_of_range if the start or end position lies outside the grid
+ */
+void DStarLite::reset(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x)
+{
+    this->stride = this->map->get_stride();
+    this->start = to_cell(start_position_y, start_position_x);
+    this->goal = to_cell(end_position_y, end_position_x);
+    this->last_start = this->start;
+    this->key_offset = 0;
+
+    this->g.assign(this->map->cell_count(), INFINITE_COST);
+    this->rhs.assign(this->map->cell_count(), INFINITE_COST);
+    this->open_list.clear();
+    this->open_list.reserve(this->map->cell_count());
+    this->path.clear();
+
+    this->rhs[this->goal] = 0;
+    this->open_list.push(this->goal, calculate_key(this->goal));
+}
+
+/**
+ * @brief Record the time of every plan() in a histogram, nothing when built with PLANNER_NO_STATS
+ *
+ * @param latency_histogram Histogram that must outlive the planner; nullptr detaches it
+ */
+void DStarLite::set_latency_histogram(LatencyHistogram *latency_histogram)
+{
+    this->latency_histogram = latency_histogram;
+}
+
+/**
+ * @brief Bring the search tree up to date with the map and return the path from the start
+ *
+ * The first call after reset() is a full backward A*; later calls only repair what the edits and
+ * start moves since the last call invalidated.
+ *
+ * @return std::uint32_t Number of Steps, 0 if the goal cannot be reached
+ */
+std::uint32_t DStarLite::plan(void)
+{
+    PLANNER_STAT(auto search_begin = std::chrono::steady_clock::now());
+    this->stats = SearchStats();
+    const std::uint8_t *cells = this->map->data();
+    std::uint32_t steps = 0;
+    if (cells[this->start] != BLOCK_OBSTACLE && cells[this->goal] != BLOCK_OBSTACLE)
+    {
+        compute_shortest_path();
+        PLANNER_STAT(this->stats.search_ns = elapsed_ns(search_begin));
+        steps = extract_path();
+        PLANNER_STAT(this->stats.extract_ns = elapsed_ns(search_begin) - this->stats.search_ns);
+    }
+    else
+        this->path.clear();
+    this->stats.path_length = steps;
+    PLANNER_STAT(if (this->latency_histogram != nullptr) this->latency_histogram->record(elapsed_ns(search_begin)));
+    return steps;
+}
+
+/**
+ * @brief Move the start, e.g. to the next cell of the path; the search tree is kept
+ *
+ * @param start_position_y 1-based
+ * @param start_position_x 1-based
+ * @throw std::out_of_range if the position lies outside the grid
+ */
+void DStarLite::move_start(std::uint32_t start_position_y, std::uint32_t start_position_x)
+{
+    this->start = to_cell(start_position_y, start_position_x);
+    this->key_offset += heuristic(this->last_start, this->start);
+    this->last_start = this->start;
+}
+
+/**
+ * @brief Block a cell of the map and mark the affected part of the search tree for repair
+ *
+ * @param y 0-based, like GridMap and ComponentIndex
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the grid
+ */
+void DStarLite::add_obstacle(std::uint32_t y, std::uint32_t x)
+{
+    if (!this->map->in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    std::uint32_t cell = this->map->index(y, x);
+    if (this->map->data()[cell] == BLOCK_OBSTACLE)
+        return;
+    this->map->data()[cell] = BLOCK_OBSTACLE;
+    this->map->mark_modified();
+    update_around(cell);
+}
+
+/**
+ * @brief Free a cell of the map and mark the affected part of the search tree for repair
+ *
+ * @param y 0-based, like GridMap and ComponentIndex
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the grid
+ */
+void DStarLite::remove_obstacle(std::uint32_t y, std::uint32_t x)
+{
+    if (!this->map->in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    std::uint32_t cell = this->map->index(y, x);
+    if (this->map->data()[cell] != BLOCK_OBSTACLE)
+        return;
+    this->map->data()[cell] = BLOCK_EMPTY;
+    this->map->mark_modified();
+    update_around(cell);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file dstar_lite.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief D* Lite incremental replanning on a map whose obstacles change between queries
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_DSTAR_LITE_HPP
+#define PLANNER_DSTAR_LITE_HPP
+
+#include "grid_map.hpp"
+#include "indexed_heap.hpp"
+#include "start_search.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Priority of a D* Lite open cell: [min(g, rhs) + h + km ; min(g, rhs)]
+ */
+struct DStarKey
+{
+    double primary;
+    double secondary;
+
+    bool operator<(const DStarKey &other) const
+    {
+        return (primary < other.primary) || (primary == other.primary && secondary < other.secondary);
+    }
+};
+
+/* ---------------------------- D* LITE CLASS ------------------------------ */
+/**
+ * @brief Koenig and Likhachev's D* Lite (optimized version) on the weighted 8-connected grid
+ *
+ * The search runs backwards from the goal, keeping for every cell its cost-to-goal g and the
+ * one-step lookahead rhs = min(move + g(neighbour)). A cell with g != rhs is inconsistent and
+ * queued. plan() only settles the inconsistent cells that can still change the path of the start,
+ * so after add_obstacle() / remove_obstacle() it repairs the part of the search tree around the
+ * edited cells instead of searching from scratch. move_start() lets the start follow the robot
+ * without replanning.
+ *
+ * The planner edits its map itself; change obstacles only through it (or call reset() after
+ * editing the map directly). Edits take 0-based cells like GridMap and ComponentIndex; endpoints
+ * stay 1-based like StartSearch. Moves and costs are those of DIJKSTRA_SEARCH.
+ */
+class DStarLite
+{
+private:
+    GridMap *map;                         // Map being planned on, owned by the caller
+    std::uint32_t stride;
+    MoveCosts move_costs;
+    std::uint32_t start, goal, last_start; // Cell indices; last_start is the start of the last key offset
+    double key_offset;                    // km, summed heuristic drift of the moving start
+    std::vector<double> g;                // Cost-to-goal settled by the search
+    std::vector<double> rhs;              // One-step lookahead cost-to-goal
+    IndexedHeap<DStarKey> open_list;      // Inconsistent cells
+    GridPath path;                        // Cells of the last path, start first
+    SearchStats stats;                    // Statistics of the last plan()
+    LatencyHistogram *latency_histogram;  // Optional histogram of plan() times, owned by the caller
+
+    double heuristic(std::uint32_t from, std::uint32_t to) const;
+    DStarKey calculate_key(std::uint32_t cell) const;
+    bool is_before_start(const DStarKey &key, const DStarKey &start_key) const;
+    double lookahead(std::uint32_t cell) const;
+    void update_vertex(std::uint32_t cell);
+    void update_around(std::uint32_t cell);
+    void compute_shortest_path(void);
+    std::uint32_t extract_path(void);
+    std::uint32_t to_cell(std::uint32_t y, std::uint32_t x) const;
+
+public:
+    explicit DStarLite(GridMap &map);
+    void set_move_costs(MoveCosts move_costs);
+    void reset(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x);
+    std::uint32_t plan(void);
+    void move_start(std::uint32_t start_position_y, std::uint32_t start_position_x);
+    void add_obstacle(std::uint32_t y, std::uint32_t x);
+    void remove_obstacle(std::uint32_t y, std::uint32_t x);
+    const GridPath &get_path(void) const { return path; }
+    const SearchStats &get_stats(void) const { return stats; }
+    void set_latency_histogram(LatencyHistogram *latency_histogram);
+};
+
+#endif // PLANNER_DSTAR_LITE_HPP
@@ -0,0 +1,101 @@
+/**
+ * @file event_ring.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Bounded lock-free ring handing events from one producer thread to one consumer thread
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_EVENT_RING_HPP
+#define PLANNER_EVENT_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Single-producer single-consumer ring of fixed capacity.
+ *
+ * The producer never waits: try_push() fails when the ring is full and the caller decides what to
+ * drop. head and tail only grow and sit on their own cache lines. Each side also keeps a private
+ * copy of the other side's index and reloads it only when the ring looks full (or empty), so a
+ * push or pop normally touches no cache line written by the other thread.
+ *
+ * @tparam Event Trivially copyable payload
+ */
+template <typename Event>
+class EventRing
+{
+private:
+    std::unique_ptr<Event[]> slots;
+    std::size_t mask;                           // Capacity - 1, capacity is a power of two
+
+    alignas(64) std::atomic<std::size_t> tail;  // Next slot the producer writes
+    std::size_t producer_head;                  // Producer's last view of head
+
+    alignas(64) std::atomic<std::size_t> head;  // Next slot the consumer reads
+    std::size_t consumer_tail;                  // Consumer's last view of tail
+
+public:
+    /**
+     * @param capacity Events the ring holds, rounded up to a power of two
+     */
+    explicit EventRing(std::size_t capacity) : tail(0), producer_head(0), head(0), consumer_tail(0)
+    {
+        std::size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        slots.reset(new Event[size]);
+        mask = size - 1;
+    }
+
+    EventRing(const EventRing &) = delete;
+    EventRing &operator=(const EventRing &) = delete;
+
+    std::size_t capacity(void) const { return mask + 1; }
+
+    /**
+     * @brief Producer side: append an event
+     *
+     * @return false if the ring is full, the event is not stored
+     */
+    bool try_push(const Event &event)
+    {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        if (position - producer_head > mask)
+        {
+            producer_head = head.load(std::memory_order_acquire);
+            if (position - producer_head > mask)
+                return false;
+        }
+        slots[position & mask] = event;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side: take up to max_events events, oldest first
+     *
+     * @return std::size_t Number of events copied to events
+     */
+    std::size_t pop(Event *events, std::size_t max_events)
+    {
+        std::size_t position = head.load(std::memory_order_relaxed);
+        if (position == consumer_tail)
+        {
+            consumer_tail = tail.load(std::memory_order_acquire);
+            if (position == consumer_tail)
+                return 0;
+        }
+        std::size_t available = consumer_tail - position;
+        std::size_t taken = available < max_events ? available : max_events;
+        for (std::size_t i = 0; i < taken; i++)
+            events[i] = slots[(position + i) & mask];
+        head.store(position + taken, std::memory_order_release);
+        return taken;
+    }
+};
+
+#endif // PLANNER_EVENT_RING_HPP
@@ -0,0 +1,288 @@
+/**
+ * @file goal_field_cache.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Goal-rooted distance and successor fields in a memory-bounded LRU cache
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "goal_field_cache.hpp"
+#include "common.hpp"
+#include "indexed_heap.hpp"
+
+#include <stdexcept>
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/* ------------------------------ GOAL FIELD -------------------------------- */
+/**
+ * @brief Follow the successors from a start down to the goal
+ *
+ * @param start_y 0-based
+ * @param start_x 0-based
+ * @param path Filled with the cells from start to goal, emptied if the goal cannot be reached
+ * @return std::uint32_t Number of Steps, 0 if the goal cannot be reached
+ */
+std::uint32_t GoalField::walk(std::uint32_t start_y, std::uint32_t start_x, GridPath &path) const
+{
+    path.stride = this->stride;
+    path.clear();
+    std::uint32_t cell = start_y * this->stride + start_x;
+    if (this->successor[cell] == GOAL_FIELD_NO_SUCCESSOR)
+        return 0;
+
+    path.cells.push_back(cell);
+    while (cell != this->goal)
+    {
+        cell = this->successor[cell];
+        path.cells.push_back(cell);
+    }
+    return path.size();
+}
+
+/* ------------------------------- CONSTRUCTOR ------------------------------ */
+/**
+ * @brief Construct an empty cache for the fields of one map
+ *
+ * @param map Map the fields are computed on, must outlive the cache
+ * @param capacity Bytes the cached fields may hold together
+ */
+GoalFieldCache::GoalFieldCache(const GridMap &map, std::size_t capacity)
+{
+    this->map = &map;
+    this->capacity = capacity;
+    this->held_bytes = 0;
+}
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Find a field and mark it most recently used; drops the fields of older map versions
+ *
+ * @return std::shared_ptr<const GoalField> nullptr if no field matches
+ */
+std::shared_ptr<const GoalField> GoalFieldCache::find(std::uint32_t goal, const std::string &search_type, const MoveCosts &move_costs)
+{
+    std::uint64_t version = this->map->get_version();
+    for (auto entry = this->fields.begin(); entry != this->fields.end();)
+    {
+        const GoalField &field = **entry;
+        if (field.version != version)
+        {
+            this->held_bytes -= field.bytes();
+            this->stats.invalidations++;
+            entry = this->fields.erase(entry);
+            continue;
+        }
+        if (field.goal == goal && field.search_type == search_type &&
+            field.move_costs.straight == move_costs.straight && field.move_costs.diagonal == move_costs.diagonal)
+        {
+            this->fields.splice(this->fields.begin(), this->fields, entry);
+            return this->fields.front();
+        }
+        ++entry;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Drop least recently used fields until the cache holds at most bytes
+ */
+void GoalFieldCache::evict_to(std::size_t bytes)
+{
+    while (!this->fields.empty() && this->held_bytes > bytes)
+    {
+        this->held_bytes -= this->fields.back()->bytes();
+        this->fields.pop_back();
+        this->stats.evictions++;
+    }
+}
+
+/**
+ * @brief Cache a computed field as most recently used; a field above the capacity is not kept
+ */
+void GoalFieldCache::insert(const std::shared_ptr<const GoalField> &field)
+{
+    if (field->bytes() > this->capacity)
+        return;
+    evict_to(this->capacity - field->bytes());
+    this->fields.push_front(field);
+    this->held_bytes += field->bytes();
+}
+
+/* ---------------------------- FIELD FUNCTIONS ----------------------------- */
+/**
+ * @brief Reverse BFS from the goal over straight moves; distances are step counts
+ */
+void GoalFieldCache::compute_bfs(GoalField &field) const
+{
+    const std::uint8_t *cells = this->map->data();
+    std::vector<std::uint32_t> queue(this->map->cell_count());
+    std::uint32_t head = 0, tail = 0;
+
+    field.distance[field.goal] = 0;
+    field.successor[field.goal] = field.goal;
+    queue[tail++] = field.goal;
+    while (head != tail)
+    {
+        std::uint32_t cell = queue[head++];
+        std::int64_t y = cell / this->map->get_stride();
+        std::int64_t x = cell % this->map->get_stride();
+        for (std::uint8_t dir = 0; dir < 4; dir++)
+        {
+            std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+            if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                continue;
+            std::uint32_t neighbour = this->map->index(neighbour_y, neighbour_x);
+            if (cells[neighbour] == BLOCK_OBSTACLE || field.successor[neighbour] != GOAL_FIELD_NO_SUCCESSOR)
+                continue;
+            field.distance[neighbour] = field.distance[cell] + 1;
+            field.successor[neighbour] = cell;
+            queue[tail++] = neighbour;
+        }
+    }
+}
+
+/**
+ * @brief Reverse Dijkstra from the goal over straight and diagonal moves priced by the field's move costs
+ */
+void GoalFieldCache::compute_dijkstra(GoalField &field) const
+{
+    const std::uint8_t *cells = this->map->data();
+    IndexedHeap<double> open_list;
+    open_list.reserve(this->map->cell_count());
+    std::vector<bool> settled(this->map->cell_count(), false);
+
+    field.distance[field.goal] = 0;
+    field.successor[field.goal] = field.goal;
+    open_list.push(field.goal, 0);
+    while (!open_list.empty())
+    {
+        std::uint32_t cell = open_list.pop();
+        settled[cell] = true;
+        std::int64_t y = cell / this->map->get_stride();
+        std::int64_t x = cell % this->map->get_stride();
+        for (std::uint8_t dir = 0; dir < 8; dir++)
+        {
+            std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+            if (!this->map->in_bounds(neighbour_y, neighbour_x))
+                continue;
+            std::uint32_t neighbour = this->map->index(neighbour_y, neighbour_x);
+            if (cells[neighbour] == BLOCK_OBSTACLE || settled[neighbour])
+                continue;
+            double distance = field.distance[cell] + ((dir < 4) ? field.move_costs.straight : field.move_costs.diagonal);
+            if (distance >= field.distance[neighbour])
+                continue;
+            field.distance[neighbour] = distance;
+            field.successor[neighbour] = cell;
+            if (open_list.contains(neighbour))
+                open_list.decrease_key(neighbour, distance);
+            else
+                open_list.push(neighbour, distance);
+        }
+    }
+}
+
+/**
+ * @brief Field of a goal for the current map, computed on a miss
+ *
+ * @param goal_y 0-based, a free cell
+ * @param goal_x 0-based, a free cell
+ * @param search_type BFS_SEARCH or DIJKSTRA_SEARCH
+ * @param move_costs Prices of a DIJKSTRA_SEARCH field, ignored for BFS_SEARCH
+ * @param computed_bytes Optional, set to the bytes this call allocated for a field, 0 on a hit
+ * @return std::shared_ptr<const GoalField> Valid for as long as the caller holds it and the map is unchanged
+ * @throw std::out_of_range if the goal lies outside the map
+ * @throw std::invalid_argument for any other search type
+ */
+std::shared_ptr<const GoalField> GoalFieldCache::field(std::uint32_t goal_y, std::uint32_t goal_x, const std::string &search_type, MoveCosts move_costs, std::size_t *computed_bytes)
+{
+    if (computed_bytes != nullptr)
+        *computed_bytes = 0;
+    if (!this->map->in_bounds(goal_y, goal_x))
+        throw std::out_of_range("Goal outside the grid");
+    if (search_type != BFS_SEARCH && search_type != DIJKSTRA_SEARCH)
+        throw std::invalid_argument("Goal fields hold BFS or Dijkstra distances only");
+    if (search_type == BFS_SEARCH)
+        move_costs = MoveCosts(); // One key per BFS goal, whatever the caller's prices
+
+    std::uint32_t goal = this->map->index(goal_y, goal_x);
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        std::shared_ptr<const GoalField> cached = find(goal, search_type, move_costs);
+        if (cached != nullptr)
+        {
+            this->stats.hits++;
+            return cached;
+        }
+        this->stats.misses++;
+    }
+
+    // Flood outside the lock, so lookups of other goals are not held up
+    std::shared_ptr<GoalField> computed = std::make_shared<GoalField>();
+    computed->goal = goal;
+    computed->version = this->map->get_version();
+    computed->search_type = search_type;
+    computed->move_costs = move_costs;
+    computed->stride = this->map->get_stride();
+    computed->distance.assign(this->map->cell_count(), GOAL_FIELD_UNREACHED);
+    computed->successor.assign(this->map->cell_count(), GOAL_FIELD_NO_SUCCESSOR);
+    if (search_type == BFS_SEARCH)
+        compute_bfs(*computed);
+    else
+        compute_dijkstra(*computed);
+    if (computed_bytes != nullptr)
+        *computed_bytes = computed->bytes(); // Allocated even if another thread's copy is returned
+
+    std::lock_guard<std::mutex> guard(this->lock);
+    // Another thread may have computed the same field meanwhile
+    std::shared_ptr<const GoalField> cached = find(goal, search_type, move_costs);
+    if (cached != nullptr)
+        return cached;
+    insert(computed);
+    return computed;
+}
+
+/**
+ * @brief Change the memory bound, evicting least recently used fields above it
+ *
+ * @param capacity Bytes the cached fields may hold together
+ */
+void GoalFieldCache::set_capacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> guard(this->lock);
+    this->capacity = capacity;
+    evict_to(capacity);
+}
+
+/**
+ * @brief Drop every field and reset the statistics
+ */
+void GoalFieldCache::clear(void)
+{
+    std::lock_guard<std::mutex> guard(this->lock);
+    this->fields.clear();
+    this->held_bytes = 0;
+    this->stats = GoalFieldCacheStats();
+}
+
+/**
+ * @brief Snapshot of the cache activity
+ *
+ * @return GoalFieldCacheStats
+ */
+GoalFieldCacheStats GoalFieldCache::get_stats(void) const
+{
+    std::lock_guard<std::mutex> guard(this->lock);
+    GoalFieldCacheStats snapshot = this->stats;
+    snapshot.fields = this->fields.size();
+    snapshot.bytes = this->held_bytes;
+    return snapshot;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file goal_field_cache.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Goal-rooted distance and successor fields in a memory-bounded LRU cache
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_GOAL_FIELD_CACHE_HPP
+#define PLANNER_GOAL_FIELD_CACHE_HPP
+
+#include "grid_map.hpp"
+#include "grid_path.hpp"
+#include "start_search.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define GOAL_FIELD_UNREACHED std::numeric_limits<double>::infinity()
+#define GOAL_FIELD_NO_SUCCESSOR UINT32_MAX
+#define GOAL_FIELD_DEFAULT_CAPACITY (256u << 20) // Bytes, about 20 fields of a 1024x1024 map
+
+/* ----------------------------- GOAL FIELD -------------------------------- */
+/**
+ * @brief Cost-to-goal and next cell towards the goal of every cell, from one reverse search
+ *
+ * BFS fields hold step counts over straight moves, Dijkstra fields move costs over straight and
+ * diagonal moves; both answer any start with the path length of the matching search.
+ */
+struct GoalField
+{
+    std::uint32_t goal;                  // Cell index of the goal
+    std::uint64_t version;               // Map version the field was computed on
+    std::string search_type;             // BFS_SEARCH or DIJKSTRA_SEARCH
+    MoveCosts move_costs;                // Prices of a Dijkstra field
+    std::uint32_t stride;
+    std::vector<double> distance;        // Cost to the goal, GOAL_FIELD_UNREACHED if the goal cannot be reached
+    std::vector<std::uint32_t> successor; // Next cell towards the goal, GOAL_FIELD_NO_SUCCESSOR if unreached; the goal points at itself
+
+    std::size_t bytes(void) const { return distance.size() * sizeof(double) + successor.size() * sizeof(std::uint32_t); }
+    std::uint32_t walk(std::uint32_t start_y, std::uint32_t start_x, GridPath &path) const;
+};
+
+/**
+ * @brief Cache activity since construction or the last clear()
+ */
+struct GoalFieldCacheStats
+{
+    std::uint64_t hits = 0;          // Lookups answered from a cached field
+    std::uint64_t misses = 0;        // Lookups that computed a field
+    std::uint64_t evictions = 0;     // Fields dropped to stay within the capacity
+    std::uint64_t invalidations = 0; // Fields dropped because the map changed
+    std::uint32_t fields = 0;        // Fields held now
+    std::size_t bytes = 0;           // Memory held by those fields
+};
+
+/* -------------------------- GOAL FIELD CACHE CLASS ------------------------ */
+/**
+ * @brief Reverse BFS / Dijkstra fields of recently used goals, least recently used evicted first
+ *
+ * A field is keyed by goal cell, map version, search type and move costs. The first query to a
+ * goal floods the map backwards from it once; every later query to the goal follows the stored
+ * successors from its start in O(path length) without a search. Fields of an older map version
+ * are dropped on the next lookup.
+ *
+ * The cache is shared: lookups lock it only to find or insert a field, fields are computed outside
+ * the lock and handed out as shared pointers, so an evicted field stays valid while a query walks it.
+ * The map must not change while a field is computed or walked.
+ */
+class GoalFieldCache
+{
+private:
+    const GridMap *map;
+    std::size_t capacity;                                // Upper bound on the bytes held by fields
+    std::list<std::shared_ptr<const GoalField>> fields;  // Most recently used first; a handful of fields, searched linearly
+    std::size_t held_bytes;
+    GoalFieldCacheStats stats;
+    mutable std::mutex lock;
+
+    std::shared_ptr<const GoalField> find(std::uint32_t goal, const std::string &search_type, const MoveCosts &move_costs);
+    void insert(const std::shared_ptr<const GoalField> &field);
+    void evict_to(std::size_t bytes);
+    void compute_bfs(GoalField &field) const;
+    void compute_dijkstra(GoalField &field) const;
+
+public:
+    explicit GoalFieldCache(const GridMap &map, std::size_t capacity = GOAL_FIELD_DEFAULT_CAPACITY);
+    std::shared_ptr<const GoalField> field(std::uint32_t goal_y, std::uint32_t goal_x, const std::string &search_type, MoveCosts move_costs = MoveCosts(), std::size_t *computed_bytes = nullptr);
+    void set_capacity(std::size_t capacity);
+    void clear(void);
+    const GridMap &get_map(void) const { return *map; }
+    GoalFieldCacheStats get_stats(void) const;
+};
+
+#endif // PLANNER_GOAL_FIELD_CACHE_HPP
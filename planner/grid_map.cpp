@@ -0,0 +1,182 @@
+/**
+ * @file grid_map.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Runtime-sized occupancy grid stored as one contiguous buffer with a row stride
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "grid_map.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Last version handed out to any map
+ */
+static std::atomic<std::uint64_t> last_map_version(0);
+
+/**
+ * @brief Construct an empty 0x0 map
+ */
+GridMap::GridMap(void)
+{
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->version = 0;
+}
+
+/**
+ * @brief Construct a map of empty cells
+ *
+ * @param width
+ * @param height
+ */
+GridMap::GridMap(std::uint32_t width, std::uint32_t height) : GridMap()
+{
+    resize(width, height);
+}
+
+/**
+ * @brief Copy a map; the copy owns its cells even when other searches an external buffer
+ */
+GridMap::GridMap(const GridMap &other)
+{
+    this->width = other.width;
+    this->height = other.height;
+    this->stride = other.stride;
+    this->cells.assign(other.data(), other.data() + other.cell_count());
+    this->version = other.version;
+}
+
+/**
+ * @brief Copy a map; the copy owns its cells even when other searches an external buffer
+ */
+GridMap &GridMap::operator=(const GridMap &other)
+{
+    if (this == &other)
+        return *this;
+    this->width = other.width;
+    this->height = other.height;
+    this->stride = other.stride;
+    this->cells.assign(other.data(), other.data() + other.cell_count());
+    this->external.reset();
+    mark_modified(); // Never other's version: data derived from this map's old cells may hold it
+    return *this;
+}
+
+/**
+ * @brief Take over the cells of other, which is left an empty 0x0 map
+ */
+GridMap::GridMap(GridMap &&other) noexcept
+{
+    this->width = other.width;
+    this->height = other.height;
+    this->stride = other.stride;
+    this->cells = std::move(other.cells);
+    this->external = std::move(other.external);
+    this->version = other.version;
+    other.resize_empty();
+}
+
+/**
+ * @brief Take over the cells of other, which is left an empty 0x0 map
+ */
+GridMap &GridMap::operator=(GridMap &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+    this->width = other.width;
+    this->height = other.height;
+    this->stride = other.stride;
+    this->cells = std::move(other.cells);
+    this->external = std::move(other.external);
+    mark_modified(); // Never other's version: data derived from this map's old cells may hold it
+    other.resize_empty();
+    return *this;
+}
+
+/**
+ * @brief Drop the cells after a move, so data derived from the moved-out cells is stale
+ */
+void GridMap::resize_empty(void) noexcept
+{
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->cells.clear();
+    this->external.reset();
+    mark_modified();
+}
+
+/**
+ * @brief Give the map a version no map has had before
+ */
+void GridMap::mark_modified(void) noexcept
+{
+    this->version = last_map_version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+/**
+ * @brief Resize the map and mark every cell BLOCK_EMPTY
+ *
+ * @param width
+ * @param height
+ * @throw std::length_error if width * height does not fit a 32-bit cell index
+ */
+void GridMap::resize(std::uint32_t width, std::uint32_t height)
+{
+    if (static_cast<std::uint64_t>(width) * height > GRID_MAX_CELLS)
+        throw std::length_error("Grid of " + std::to_string(width) + "x" + std::to_string(height) + " exceeds the 32-bit cell index range");
+
+    this->width = width;
+    this->height = height;
+    this->stride = width;
+    this->external.reset();
+    this->cells.assign(static_cast<std::size_t>(this->height) * this->stride, BLOCK_EMPTY);
+    mark_modified();
+}
+
+/**
+ * @brief Set every cell to value
+ *
+ * @param value BLOCK_* marker
+ */
+void GridMap::fill(std::uint8_t value)
+{
+    std::fill(data(), data() + cell_count(), value);
+    mark_modified();
+}
+
+/**
+ * @brief Search an external buffer of cells in place instead of the map's own
+ *
+ * The map's own cells are released. resize() and copies go back to owned cells.
+ *
+ * @param cells height * stride BLOCK_* values, row-major; kept alive as long as the map uses it
+ * @param width
+ * @param height
+ * @param stride Cells from one row to the next, at least width
+ * @throw std::length_error if height * stride does not fit a 32-bit cell index
+ * @throw std::invalid_argument if the stride is below the width
+ */
+void GridMap::adopt(std::shared_ptr<std::uint8_t> cells, std::uint32_t width, std::uint32_t height, std::uint32_t stride)
+{
+    if (static_cast<std::uint64_t>(stride) * height > GRID_MAX_CELLS)
+        throw std::length_error("Grid of " + std::to_string(stride) + "x" + std::to_string(height) + " exceeds the 32-bit cell index range");
+    if (stride < width)
+        throw std::invalid_argument("Row stride below the grid width");
+
+    this->width = width;
+    this->height = height;
+    this->stride = stride;
+    std::vector<std::uint8_t>().swap(this->cells);
+    this->external = std::move(cells);
+    mark_modified();
+}
@@ -0,0 +1,82 @@
+/**
+ * @file grid_map.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Runtime-sized occupancy grid stored as one contiguous buffer with a row stride
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_GRID_MAP_HPP
+#define PLANNER_GRID_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Largest number of cells a map may hold.
+ *
+ * Cell indices are 32-bit and UINT32_MAX is kept free as a "no cell" marker.
+ */
+#define GRID_MAX_CELLS (UINT32_MAX - 1)
+
+/* ------------------------------ GRID MAP CLASS ---------------------------- */
+/**
+ * @brief Occupancy grid of BLOCK_* values, row-major.
+ *
+ * Cell (y,x) lives at y * stride + x. Every per-cell array of the planners uses the same
+ * indexing, so a cell index fits in 32 bits for any map accepted by resize().
+ *
+ * The version identifies the contents of the map for derived data (component labels, cached
+ * distance fields). Versions come from one process-wide counter and are never reused, so a map
+ * that is resized, refilled, assigned to or handed a new buffer never lands on a version some
+ * derived data was built against. resize(), fill(), adopt() and assignment take a fresh version;
+ * code writing cells through at() or data() calls mark_modified() once it is done.
+ *
+ * The cells live in a buffer of the map, or in an external one handed over with adopt() (e.g. a
+ * memory-mapped map file), which the map keeps alive and searches in place. Copies always own
+ * their cells.
+ */
+class GridMap
+{
+private:
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t stride;
+    std::vector<std::uint8_t> cells;
+    std::shared_ptr<std::uint8_t> external; // Cells not owned by the map, nullptr when cells are used
+    std::uint64_t version; // Advanced on every change of the cells
+
+    void resize_empty(void) noexcept;
+
+public:
+    GridMap(void);
+    GridMap(std::uint32_t width, std::uint32_t height);
+    GridMap(const GridMap &other);
+    GridMap(GridMap &&other) noexcept;
+    GridMap &operator=(const GridMap &other);
+    GridMap &operator=(GridMap &&other) noexcept;
+    void resize(std::uint32_t width, std::uint32_t height);
+    void fill(std::uint8_t value);
+    void adopt(std::shared_ptr<std::uint8_t> cells, std::uint32_t width, std::uint32_t height, std::uint32_t stride);
+    bool is_external(void) const { return external != nullptr; }
+
+    std::uint32_t get_width(void) const { return width; }
+    std::uint32_t get_height(void) const { return height; }
+    std::uint32_t get_stride(void) const { return stride; }
+    std::uint32_t cell_count(void) const { return height * stride; }
+    std::uint64_t get_version(void) const { return version; }
+    void mark_modified(void) noexcept;
+    std::uint8_t *data(void) { return external ? external.get() : cells.data(); }
+    const std::uint8_t *data(void) const { return external ? external.get() : cells.data(); }
+
+    std::uint32_t index(std::uint32_t y, std::uint32_t x) const { return y * stride + x; }
+    bool in_bounds(std::int64_t y, std::int64_t x) const { return y >= 0 && x >= 0 && y < height && x < width; }
+    std::uint8_t &at(std::uint32_t y, std::uint32_t x) { return data()[index(y, x)]; }
+    std::uint8_t at(std::uint32_t y, std::uint32_t x) const { return data()[index(y, x)]; }
+};
+
+#endif // PLANNER_GRID_MAP_HPP
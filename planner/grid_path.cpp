@@ -0,0 +1,133 @@
+/**
+ * @file grid_path.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Paths as packed cell indices, with turn-point and run-length compressed forms
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "grid_path.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * @brief Neighbour offsets, the four straight moves first; a run code stores the index
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/**
+ * @brief Direction index of a single move between neighbouring cells
+ */
+static std::uint8_t move_direction(std::uint32_t from, std::uint32_t to, std::uint32_t stride)
+{
+    int dy = static_cast<int>(to / stride) - static_cast<int>(from / stride);
+    int dx = static_cast<int>(to % stride) - static_cast<int>(from % stride);
+    for (std::uint8_t dir = 0; dir < 8; dir++)
+        if (NEIGHBOUR_DY[dir] == dy && NEIGHBOUR_DX[dir] == dx)
+            return dir;
+    return 0; // Not a move; paths of the planners never get here
+}
+
+/* ---------------------------- TURN-POINT FORM ----------------------------- */
+/**
+ * @brief Start, every cell where the direction changes, and goal
+ *
+ * @return std::vector<std::uint32_t> Cell indices; consecutive ones lie on a straight or diagonal line
+ */
+std::vector<std::uint32_t> GridPath::waypoints(void) const
+{
+    if (this->cells.size() <= 2)
+        return this->cells;
+
+    std::vector<std::uint32_t> turns(1, this->cells.front());
+    std::uint8_t heading = move_direction(this->cells[0], this->cells[1], this->stride);
+    for (std::size_t pos = 1; pos + 1 < this->cells.size(); pos++)
+    {
+        std::uint8_t next = move_direction(this->cells[pos], this->cells[pos + 1], this->stride);
+        if (next != heading)
+            turns.push_back(this->cells[pos]);
+        heading = next;
+    }
+    turns.push_back(this->cells.back());
+    return turns;
+}
+
+/**
+ * @brief Restore the cells from waypoints(), walking the line between every two waypoints
+ *
+ * @param waypoints Output of waypoints()
+ * @param stride Row stride of the map
+ */
+void GridPath::assign_waypoints(const std::vector<std::uint32_t> &waypoints, std::uint32_t stride)
+{
+    this->stride = stride;
+    this->cells.clear();
+    if (waypoints.empty())
+        return;
+
+    this->cells.push_back(waypoints.front());
+    for (std::size_t pos = 1; pos < waypoints.size(); pos++)
+    {
+        std::int64_t dy = static_cast<std::int64_t>(waypoints[pos] / stride) - static_cast<std::int64_t>(waypoints[pos - 1] / stride);
+        std::int64_t dx = static_cast<std::int64_t>(waypoints[pos] % stride) - static_cast<std::int64_t>(waypoints[pos - 1] % stride);
+        std::int64_t moves = std::max(std::abs(dy), std::abs(dx));
+        std::int64_t step = ((dy > 0) - (dy < 0)) * static_cast<std::int64_t>(stride) + ((dx > 0) - (dx < 0));
+        for (std::int64_t move = 1; move <= moves; move++)
+            this->cells.push_back(waypoints[pos - 1] + move * step);
+    }
+}
+
+/* ---------------------------- RUN-LENGTH FORM ----------------------------- */
+/**
+ * @brief Start cell, then one word per run of equal moves: (direction << 29) | moves
+ *
+ * @return std::vector<std::uint32_t> Empty for an empty path
+ */
+std::vector<std::uint32_t> GridPath::run_codes(void) const
+{
+    std::vector<std::uint32_t> codes;
+    if (this->cells.empty())
+        return codes;
+
+    codes.push_back(this->cells.front());
+    for (std::size_t pos = 1; pos < this->cells.size(); pos++)
+    {
+        std::uint32_t direction = move_direction(this->cells[pos - 1], this->cells[pos], this->stride);
+        if (codes.size() > 1 && codes.back() >> PATH_RUN_LENGTH_BITS == direction && (codes.back() & PATH_RUN_MAX_LENGTH) < PATH_RUN_MAX_LENGTH)
+            codes.back()++;
+        else
+            codes.push_back((direction << PATH_RUN_LENGTH_BITS) | 1);
+    }
+    return codes;
+}
+
+/**
+ * @brief Restore the cells from run_codes()
+ *
+ * @param run_codes Output of run_codes()
+ * @param stride Row stride of the map
+ */
+void GridPath::assign_run_codes(const std::vector<std::uint32_t> &run_codes, std::uint32_t stride)
+{
+    this->stride = stride;
+    this->cells.clear();
+    if (run_codes.empty())
+        return;
+
+    std::uint32_t cell = run_codes.front();
+    this->cells.push_back(cell);
+    for (std::size_t pos = 1; pos < run_codes.size(); pos++)
+    {
+        std::uint32_t direction = run_codes[pos] >> PATH_RUN_LENGTH_BITS;
+        std::int64_t step = NEIGHBOUR_DY[direction] * static_cast<std::int64_t>(stride) + NEIGHBOUR_DX[direction];
+        for (std::uint32_t move = run_codes[pos] & PATH_RUN_MAX_LENGTH; move > 0; move--)
+        {
+            cell += step;
+            this->cells.push_back(cell);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file grid_path.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Paths as packed cell indices, with turn-point and run-length compressed forms
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_GRID_PATH_HPP
+#define PLANNER_GRID_PATH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define PATH_RUN_LENGTH_BITS 29 // Low bits of a run code, the direction takes the top 3
+#define PATH_RUN_MAX_LENGTH ((1u << PATH_RUN_LENGTH_BITS) - 1)
+
+/* ------------------------------ GRID PATH -------------------------------- */
+/**
+ * @brief Cells of a path, start first, as indices y * stride + x in one contiguous buffer
+ *
+ * The planners write the cells in order, so a path costs one allocation however long it is,
+ * and that buffer is reused by the next search. Two compressed forms cover paths that are kept
+ * or sent elsewhere; both restore the exact cells:
+ * - waypoints(): start, every cell where the direction changes, and goal
+ * - run_codes(): start cell, then one word per straight run, (direction << 29) | moves
+ */
+struct GridPath
+{
+    std::uint32_t stride = 0;         // Row stride of the map the cells index
+    std::vector<std::uint32_t> cells; // Cell indices, start first
+
+    std::size_t size(void) const { return cells.size(); }
+    bool empty(void) const { return cells.empty(); }
+    void clear(void) { cells.clear(); }
+    std::uint32_t y(std::size_t pos) const { return cells[pos] / stride; }
+    std::uint32_t x(std::size_t pos) const { return cells[pos] % stride; }
+
+    std::vector<std::uint32_t> waypoints(void) const;
+    void assign_waypoints(const std::vector<std::uint32_t> &waypoints, std::uint32_t stride);
+    std::vector<std::uint32_t> run_codes(void) const;
+    void assign_run_codes(const std::vector<std::uint32_t> &run_codes, std::uint32_t stride);
+};
+
+#endif // PLANNER_GRID_PATH_HPP
@@ -0,0 +1,687 @@
+/**
+ * @file hpa_star.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Hierarchical path planning (HPA*) over fixed-size clusters of the occupancy grid
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "hpa_star.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#define INFINITE_COST std::numeric_limits<double>::infinity()
+#define NO_NODE UINT32_MAX
+
+/**
+ * @brief Borders and corners owned by a cluster, towards its east / south neighbours
+ */
+#define BORDER_EAST 0
+#define BORDER_SOUTH 1
+#define CORNER_SOUTH_EAST 2
+#define CORNER_SOUTH_WEST 3
+#define BORDERS_PER_CLUSTER 4
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/* ------------------------------- CONSTRUCTOR ------------------------------ */
+/**
+ * @brief Construct a planner on map; the abstract graph is built by the first plan()
+ *
+ * @param map Map to plan on, must outlive the planner
+ * @param cluster_size Side of a cluster in cells
+ * @param connectivity 4 -> straight moves only, 8 -> straight and diagonal moves
+ * @throw std::invalid_argument for a cluster size below 2 or another connectivity
+ */
+HpaStar::HpaStar(GridMap &map, std::uint32_t cluster_size, std::uint8_t connectivity) : refiner(map)
+{
+    if (cluster_size < 2)
+        throw std::invalid_argument("Clusters must be at least 2 cells wide");
+    if (connectivity != 4 && connectivity != 8)
+        throw std::invalid_argument("Connectivity must be 4 or 8");
+
+    this->map = &map;
+    this->connectivity = connectivity;
+    this->cluster_size = cluster_size;
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->cluster_rows = 0;
+    this->cluster_cols = 0;
+    this->version = 0;
+    this->built = false;
+    this->local_epoch = 0;
+    this->g_epoch = 0;
+
+    AStarConfig astar_config;
+    astar_config.connectivity = connectivity;
+    astar_config.heuristic = (connectivity == 4) ? HEURISTIC_MANHATTAN : HEURISTIC_OCTILE;
+    this->refiner.set_astar_config(astar_config);
+}
+
+/**
+ * @brief Set the price of straight and diagonal moves; the graph is rebuilt by the next plan()
+ *
+ * @param move_costs Positive straight and diagonal move costs
+ */
+void HpaStar::set_move_costs(MoveCosts move_costs)
+{
+    this->move_costs = move_costs;
+    this->refiner.set_move_costs(move_costs);
+    this->built = false;
+}
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Cell index of a 1-based position
+ *
+ * @throw std::out_of_range if the position lies outside the grid
+ */
+std::uint32_t HpaStar::to_cell(std::uint32_t y, std::uint32_t x) const
+{
+    if (!this->map->in_bounds(static_cast<std::int64_t>(y) - 1, static_cast<std::int64_t>(x) - 1))
+        throw std::out_of_range("Position outside the grid");
+    return (y - 1) * this->map->get_stride() + (x - 1);
+}
+
+/**
+ * @brief Cluster holding a cell
+ */
+std::uint32_t HpaStar::cluster_of(std::uint32_t cell) const
+{
+    return (cell / this->stride / this->cluster_size) * this->cluster_cols + (cell % this->stride) / this->cluster_size;
+}
+
+/**
+ * @brief Lower bound of the cost between two cells, Manhattan or octile by connectivity
+ */
+double HpaStar::heuristic(std::uint32_t from, std::uint32_t to) const
+{
+    std::uint32_t dy = std::abs(static_cast<std::int64_t>(from / this->stride) - static_cast<std::int64_t>(to / this->stride));
+    std::uint32_t dx = std::abs(static_cast<std::int64_t>(from % this->stride) - static_cast<std::int64_t>(to % this->stride));
+    if (this->connectivity == 4)
+        return this->move_costs.straight * (dx + dy);
+    double diagonal = std::min(this->move_costs.diagonal, 2 * this->move_costs.straight);
+    return this->move_costs.straight * (dx + dy) + (diagonal - 2 * this->move_costs.straight) * std::min(dx, dy);
+}
+
+/* ---------------------------- ABSTRACT GRAPH ------------------------------ */
+/**
+ * @brief Node of a transition cell, created on first use
+ */
+std::uint32_t HpaStar::acquire_node(std::uint32_t cell)
+{
+    auto found = this->node_at.find(cell);
+    if (found != this->node_at.end())
+        return found->second;
+
+    std::uint32_t node;
+    if (!this->free_nodes.empty())
+    {
+        node = this->free_nodes.back();
+        this->free_nodes.pop_back();
+    }
+    else
+    {
+        node = this->nodes.size();
+        this->nodes.emplace_back();
+    }
+    this->nodes[node].cell = cell;
+    this->nodes[node].cluster = cluster_of(cell);
+    this->nodes[node].links = 0;
+    this->nodes[node].edges.clear();
+    this->node_at[cell] = node;
+    this->cluster_nodes[this->nodes[node].cluster].push_back(node);
+    return node;
+}
+
+/**
+ * @brief Drop a node no transition uses any more; its cluster's distances are redone by the caller
+ */
+void HpaStar::release_node(std::uint32_t node)
+{
+    std::vector<std::uint32_t> &members = this->cluster_nodes[this->nodes[node].cluster];
+    members.erase(std::find(members.begin(), members.end(), node));
+    this->node_at.erase(this->nodes[node].cell);
+    this->nodes[node].edges.clear();
+    this->free_nodes.push_back(node);
+}
+
+/**
+ * @brief Add a transition across a border: one move between two free cells of neighbouring clusters
+ */
+void HpaStar::link(std::uint32_t border, std::uint32_t cell_a, std::uint32_t cell_b, double cost)
+{
+    std::uint32_t node_a = acquire_node(cell_a);
+    std::uint32_t node_b = acquire_node(cell_b);
+    this->nodes[node_a].edges.push_back(Edge{node_b, cost, true});
+    this->nodes[node_b].edges.push_back(Edge{node_a, cost, true});
+    this->nodes[node_a].links++;
+    this->nodes[node_b].links++;
+    this->border_links[border].push_back({node_a, node_b});
+}
+
+/**
+ * @brief Remove the transitions of a border, dropping nodes left without any
+ */
+void HpaStar::clear_border(std::uint32_t border)
+{
+    for (const std::pair<std::uint32_t, std::uint32_t> &pair : this->border_links[border])
+    {
+        std::uint32_t ends[2] = {pair.first, pair.second};
+        for (std::uint8_t side = 0; side < 2; side++)
+        {
+            Node &node = this->nodes[ends[side]];
+            std::uint32_t other = ends[1 - side];
+            node.edges.erase(std::find_if(node.edges.begin(), node.edges.end(), [other](const Edge &edge)
+                                          { return edge.inter && edge.to == other; }));
+        }
+        for (std::uint32_t end : ends)
+            if (--this->nodes[end].links == 0)
+                release_node(end);
+    }
+    this->border_links[border].clear();
+}
+
+/**
+ * @brief Place the transitions of a straight border given its facing cells, side_a[i] next to side_b[i]
+ *
+ * Every run of free facing pairs is one entrance, crossed in its middle or at both ends when it is
+ * HPA_LONG_ENTRANCE or wider; the free cells of a run are connected along the border on both sides.
+ * A diagonal crossing is only linked when neither of its cells belongs to a run, otherwise the run
+ * plus one step along the border replaces it.
+ */
+void HpaStar::scan_border(std::uint32_t border, const std::vector<std::uint32_t> &side_a, const std::vector<std::uint32_t> &side_b)
+{
+    std::uint32_t length = side_a.size();
+    std::vector<bool> facing(length);
+    for (std::uint32_t i = 0; i < length; i++)
+        facing[i] = is_free(side_a[i]) && is_free(side_b[i]);
+
+    for (std::uint32_t begin = 0; begin < length;)
+    {
+        if (!facing[begin])
+        {
+            begin++;
+            continue;
+        }
+        std::uint32_t end = begin;
+        while (end < length && facing[end])
+            end++;
+        if (end - begin >= HPA_LONG_ENTRANCE)
+        {
+            link(border, side_a[begin], side_b[begin], this->move_costs.straight);
+            link(border, side_a[end - 1], side_b[end - 1], this->move_costs.straight);
+        }
+        else
+        {
+            std::uint32_t middle = (begin + end - 1) / 2;
+            link(border, side_a[middle], side_b[middle], this->move_costs.straight);
+        }
+        begin = end;
+    }
+
+    if (this->connectivity != 8)
+        return;
+    for (std::uint32_t i = 0; i + 1 < length; i++)
+    {
+        if (facing[i] || facing[i + 1])
+            continue;
+        if (is_free(side_a[i]) && is_free(side_b[i + 1]))
+            link(border, side_a[i], side_b[i + 1], this->move_costs.diagonal);
+        if (is_free(side_a[i + 1]) && is_free(side_b[i]))
+            link(border, side_a[i + 1], side_b[i], this->move_costs.diagonal);
+    }
+}
+
+/**
+ * @brief Place the transitions of one border or corner owned by a cluster
+ *
+ * @param border cluster * BORDERS_PER_CLUSTER + BORDER_EAST, BORDER_SOUTH, CORNER_SOUTH_EAST or CORNER_SOUTH_WEST
+ */
+void HpaStar::build_border(std::uint32_t border)
+{
+    std::uint32_t cluster = border / BORDERS_PER_CLUSTER;
+    std::uint32_t row = cluster / this->cluster_cols, col = cluster % this->cluster_cols;
+    std::uint32_t y0 = row * this->cluster_size, x0 = col * this->cluster_size;
+    std::uint32_t y1 = std::min(y0 + this->cluster_size, this->height) - 1;
+    std::uint32_t x1 = std::min(x0 + this->cluster_size, this->width) - 1;
+    bool has_east = col + 1 < this->cluster_cols, has_south = row + 1 < this->cluster_rows;
+
+    std::vector<std::uint32_t> side_a, side_b;
+    switch (border % BORDERS_PER_CLUSTER)
+    {
+    case BORDER_EAST:
+        if (!has_east)
+            return;
+        for (std::uint32_t y = y0; y <= y1; y++)
+        {
+            side_a.push_back(y * this->stride + x1);
+            side_b.push_back(y * this->stride + x1 + 1);
+        }
+        scan_border(border, side_a, side_b);
+        break;
+    case BORDER_SOUTH:
+        if (!has_south)
+            return;
+        for (std::uint32_t x = x0; x <= x1; x++)
+        {
+            side_a.push_back(y1 * this->stride + x);
+            side_b.push_back((y1 + 1) * this->stride + x);
+        }
+        scan_border(border, side_a, side_b);
+        break;
+    case CORNER_SOUTH_EAST:
+        if (this->connectivity == 8 && has_east && has_south && is_free(y1 * this->stride + x1) && is_free((y1 + 1) * this->stride + x1 + 1))
+            link(border, y1 * this->stride + x1, (y1 + 1) * this->stride + x1 + 1, this->move_costs.diagonal);
+        break;
+    case CORNER_SOUTH_WEST:
+        if (this->connectivity == 8 && col > 0 && has_south && is_free(y1 * this->stride + x0) && is_free((y1 + 1) * this->stride + x0 - 1))
+            link(border, y1 * this->stride + x0, (y1 + 1) * this->stride + x0 - 1, this->move_costs.diagonal);
+        break;
+    }
+}
+
+/**
+ * @brief Dijkstra from a free cell that never leaves its cluster; read the result with cluster_distance()
+ */
+void HpaStar::search_cluster(std::uint32_t cluster, std::uint32_t source)
+{
+    std::uint32_t y0 = (cluster / this->cluster_cols) * this->cluster_size;
+    std::uint32_t x0 = (cluster % this->cluster_cols) * this->cluster_size;
+    std::int64_t y1 = std::min(y0 + this->cluster_size, this->height);
+    std::int64_t x1 = std::min(x0 + this->cluster_size, this->width);
+    const std::uint8_t *cells = this->map->data();
+
+    if (this->local_epoch == UINT32_MAX)
+    {
+        std::fill(this->local_stamp.begin(), this->local_stamp.end(), 0);
+        this->local_epoch = 0;
+    }
+    this->local_epoch++;
+    this->local_open.clear();
+
+    std::uint32_t local = (source / this->stride - y0) * this->cluster_size + (source % this->stride - x0);
+    this->local_distance[local] = 0;
+    this->local_stamp[local] = this->local_epoch;
+    this->local_open.push(local, 0);
+    while (!this->local_open.empty())
+    {
+        local = this->local_open.pop();
+        PLANNER_STAT(this->stats.cells_expanded++);
+        std::int64_t y = y0 + local / this->cluster_size;
+        std::int64_t x = x0 + local % this->cluster_size;
+        for (std::uint8_t dir = 0; dir < this->connectivity; dir++)
+        {
+            std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+            if (neighbour_y < y0 || neighbour_x < x0 || neighbour_y >= y1 || neighbour_x >= x1 ||
+                cells[neighbour_y * this->stride + neighbour_x] == BLOCK_OBSTACLE)
+                continue;
+            std::uint32_t neighbour = (neighbour_y - y0) * this->cluster_size + (neighbour_x - x0);
+            double distance = this->local_distance[local] + ((dir < 4) ? this->move_costs.straight : this->move_costs.diagonal);
+            if (this->local_stamp[neighbour] == this->local_epoch && distance >= this->local_distance[neighbour])
+                continue;
+            this->local_distance[neighbour] = distance;
+            this->local_stamp[neighbour] = this->local_epoch;
+            if (this->local_open.contains(neighbour))
+                this->local_open.decrease_key(neighbour, distance);
+            else
+                this->local_open.push(neighbour, distance);
+        }
+    }
+}
+
+/**
+ * @brief Distance of a cell of the cluster from the source of the last search_cluster()
+ *
+ * @return double INFINITE_COST if the cell cannot be reached inside the cluster
+ */
+double HpaStar::cluster_distance(std::uint32_t cluster, std::uint32_t cell) const
+{
+    std::uint32_t y0 = (cluster / this->cluster_cols) * this->cluster_size;
+    std::uint32_t x0 = (cluster % this->cluster_cols) * this->cluster_size;
+    std::uint32_t local = (cell / this->stride - y0) * this->cluster_size + (cell % this->stride - x0);
+    return (this->local_stamp[local] == this->local_epoch) ? this->local_distance[local] : INFINITE_COST;
+}
+
+/**
+ * @brief Redo the intra-cluster edges: the cluster-local distance between every pair of its nodes
+ */
+void HpaStar::connect_cluster(std::uint32_t cluster)
+{
+    const std::vector<std::uint32_t> &members = this->cluster_nodes[cluster];
+    for (std::uint32_t node : members)
+    {
+        std::vector<Edge> &edges = this->nodes[node].edges;
+        edges.erase(std::remove_if(edges.begin(), edges.end(), [](const Edge &edge)
+                                   { return !edge.inter; }),
+                    edges.end());
+    }
+
+    for (std::uint32_t i = 0; i + 1 < members.size(); i++)
+    {
+        search_cluster(cluster, this->nodes[members[i]].cell);
+        for (std::uint32_t j = i + 1; j < members.size(); j++)
+        {
+            double distance = cluster_distance(cluster, this->nodes[members[j]].cell);
+            if (distance == INFINITE_COST)
+                continue;
+            this->nodes[members[i]].edges.push_back(Edge{members[j], distance, false});
+            this->nodes[members[j]].edges.push_back(Edge{members[i], distance, false});
+        }
+    }
+}
+
+/**
+ * @brief Cut the map into clusters and build the whole abstract graph
+ */
+void HpaStar::build(void)
+{
+    this->width = this->map->get_width();
+    this->height = this->map->get_height();
+    this->stride = this->map->get_stride();
+    this->cluster_rows = (this->height + this->cluster_size - 1) / this->cluster_size;
+    this->cluster_cols = (this->width + this->cluster_size - 1) / this->cluster_size;
+    std::uint32_t clusters = cluster_count();
+
+    this->nodes.clear();
+    this->free_nodes.clear();
+    this->node_at.clear();
+    this->cluster_nodes.assign(clusters, std::vector<std::uint32_t>());
+    this->border_links.assign(clusters * BORDERS_PER_CLUSTER, std::vector<std::pair<std::uint32_t, std::uint32_t>>());
+    this->dirty.assign(clusters, false);
+    this->dirty_list.clear();
+
+    std::uint32_t area = this->cluster_size * this->cluster_size;
+    this->local_distance.assign(area, 0);
+    this->local_stamp.assign(area, 0);
+    this->local_epoch = 0;
+    this->local_open.reserve(area);
+
+    for (std::uint32_t border = 0; border < clusters * BORDERS_PER_CLUSTER; border++)
+        build_border(border);
+    for (std::uint32_t cluster = 0; cluster < clusters; cluster++)
+        connect_cluster(cluster);
+
+    this->version = this->map->get_version();
+    this->built = true;
+}
+
+/**
+ * @brief Bring the graph up to date: redo the borders and distances around every edited cluster
+ *
+ * An edit in a cluster can only change the borders and corners that hold its cells, and the node
+ * sets of the clusters on their far side.
+ */
+void HpaStar::refresh(void)
+{
+    if (!this->built || this->version != this->map->get_version() || this->width != this->map->get_width() ||
+        this->height != this->map->get_height())
+    {
+        build();
+        return;
+    }
+    if (this->dirty_list.empty())
+        return;
+
+    std::vector<std::uint32_t> borders, clusters;
+    for (std::uint32_t cluster : this->dirty_list)
+    {
+        std::int64_t row = cluster / this->cluster_cols, col = cluster % this->cluster_cols;
+        auto owned = [this](std::int64_t row, std::int64_t col, std::uint32_t kind) -> std::int64_t
+        {
+            if (row < 0 || col < 0 || row >= this->cluster_rows || col >= this->cluster_cols)
+                return -1;
+            return (row * this->cluster_cols + col) * BORDERS_PER_CLUSTER + kind;
+        };
+        std::int64_t touched[8] = {owned(row, col, BORDER_EAST), owned(row, col, BORDER_SOUTH),
+                                   owned(row, col, CORNER_SOUTH_EAST), owned(row, col, CORNER_SOUTH_WEST),
+                                   owned(row, col - 1, BORDER_EAST), owned(row - 1, col, BORDER_SOUTH),
+                                   owned(row - 1, col - 1, CORNER_SOUTH_EAST), owned(row - 1, col + 1, CORNER_SOUTH_WEST)};
+        for (std::int64_t border : touched)
+            if (border >= 0)
+                borders.push_back(border);
+        for (std::int64_t dy = -1; dy <= 1; dy++)
+            for (std::int64_t dx = -1; dx <= 1; dx++)
+                if (row + dy >= 0 && col + dx >= 0 && row + dy < this->cluster_rows && col + dx < this->cluster_cols)
+                    clusters.push_back((row + dy) * this->cluster_cols + col + dx);
+        this->dirty[cluster] = false;
+    }
+    std::sort(borders.begin(), borders.end());
+    borders.erase(std::unique(borders.begin(), borders.end()), borders.end());
+    std::sort(clusters.begin(), clusters.end());
+    clusters.erase(std::unique(clusters.begin(), clusters.end()), clusters.end());
+
+    for (std::uint32_t border : borders)
+        clear_border(border);
+    for (std::uint32_t border : borders)
+        build_border(border);
+    for (std::uint32_t cluster : clusters)
+        connect_cluster(cluster);
+    PLANNER_STAT(this->stats.clusters_rebuilt = this->dirty_list.size());
+    this->dirty_list.clear();
+}
+
+/**
+ * @brief Queue the cluster of an edited cell for the next refresh()
+ */
+void HpaStar::mark_dirty(std::uint32_t cell)
+{
+    std::uint32_t cluster = cluster_of(cell);
+    if (this->dirty[cluster])
+        return;
+    this->dirty[cluster] = true;
+    this->dirty_list.push_back(cluster);
+}
+
+/* ------------------------------ PLAN FUNCTIONS ---------------------------- */
+/**
+ * @brief Lower the abstract A* cost of a node, the goal being node nodes.size()
+ */
+void HpaStar::relax_node(std::uint32_t node, double cost, std::uint32_t from, std::uint32_t goal)
+{
+    if (this->g_stamp[node] == this->g_epoch && cost >= this->g[node])
+        return;
+    this->g[node] = cost;
+    this->came_from[node] = from;
+    this->g_stamp[node] = this->g_epoch;
+
+    std::uint32_t cell = (node == this->nodes.size()) ? goal : this->nodes[node].cell;
+    double key = cost + heuristic(cell, goal);
+    if (this->open_list.contains(node))
+        this->open_list.decrease_key(node, key);
+    else
+        this->open_list.push(node, key);
+}
+
+/**
+ * @brief Join the low-level paths between consecutive waypoints into path
+ *
+ * @return true if every segment was found
+ */
+bool HpaStar::refine(void)
+{
+    this->path.cells.assign(1, this->waypoints.front());
+    for (std::uint32_t i = 0; i + 1 < this->waypoints.size(); i++)
+    {
+        std::uint32_t from = this->waypoints[i], to = this->waypoints[i + 1];
+        if (from == to)
+            continue;
+        this->refiner.set_endpoints(from / this->stride + 1, from % this->stride + 1, to / this->stride + 1, to % this->stride + 1);
+        std::uint32_t steps = this->refiner.initiate_search(ASTAR_SEARCH);
+        PLANNER_STAT(this->stats.refined_segments++);
+        PLANNER_STAT(this->stats.cells_expanded += this->refiner.get_stats().nodes_expanded);
+        if (steps == 0)
+        {
+            this->path.clear();
+            return false;
+        }
+        this->stats.path_cost += this->refiner.get_stats().path_cost;
+        const GridPath &segment = this->refiner.get_path();
+        this->path.cells.insert(this->path.cells.end(), segment.cells.begin() + 1, segment.cells.end());
+    }
+    return true;
+}
+
+/**
+ * @brief Plan from start to end: abstract A* over the transitions, then refine the corridor
+ *
+ * Edited clusters are rebuilt first. Start and goal are linked to the nodes of their clusters by
+ * cluster-local searches; a start and goal sharing a cluster are also linked directly.
+ *
+ * @param start_position_y 1-based
+ * @param start_position_x 1-based
+ * @param end_position_y 1-based
+ * @param end_position_x 1-based
+ * @return std::uint32_t Number of Steps, 0 if the goal cannot be reached
+ * @throw std::out_of_range if the start or end position lies outside the grid
+ */
+std::uint32_t HpaStar::plan(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x)
+{
+    PLANNER_STAT(auto phase_begin = std::chrono::steady_clock::now());
+    this->stats = HpaStats();
+    this->path.clear();
+    std::uint32_t start = to_cell(start_position_y, start_position_x);
+    std::uint32_t goal = to_cell(end_position_y, end_position_x);
+    refresh();
+    this->path.stride = this->stride;
+    PLANNER_STAT(this->stats.cells_expanded = 0); // Count the query, not the rebuild
+
+    if (!is_free(start) || !is_free(goal))
+        return 0;
+    if (start == goal)
+    {
+        this->path.cells.assign(1, start);
+        this->stats.path_length = 1;
+        return 1;
+    }
+
+    std::uint32_t goal_node = this->nodes.size();
+    if (this->g.size() < goal_node + 1)
+    {
+        this->g.resize(goal_node + 1);
+        this->came_from.resize(goal_node + 1);
+        this->g_stamp.resize(goal_node + 1, 0);
+    }
+    if (this->g_epoch == UINT32_MAX)
+    {
+        std::fill(this->g_stamp.begin(), this->g_stamp.end(), 0);
+        this->g_epoch = 0;
+    }
+    this->g_epoch++;
+    this->open_list.reserve(goal_node + 1);
+    this->open_list.clear();
+
+    // Seed the open list with the nodes (and goal) the start reaches inside its cluster
+    std::uint32_t start_cluster = cluster_of(start), goal_cluster = cluster_of(goal);
+    search_cluster(start_cluster, start);
+    for (std::uint32_t node : this->cluster_nodes[start_cluster])
+    {
+        double distance = cluster_distance(start_cluster, this->nodes[node].cell);
+        if (distance != INFINITE_COST)
+            relax_node(node, distance, NO_NODE, goal);
+    }
+    if (start_cluster == goal_cluster && cluster_distance(start_cluster, goal) != INFINITE_COST)
+        relax_node(goal_node, cluster_distance(start_cluster, goal), NO_NODE, goal);
+
+    // The goal's local distances stay in place while the abstract search runs
+    search_cluster(goal_cluster, goal);
+    PLANNER_STAT(this->stats.setup_ns = elapsed_ns(phase_begin));
+    PLANNER_STAT(phase_begin = std::chrono::steady_clock::now());
+    bool path_found = false;
+    while (!this->open_list.empty())
+    {
+        std::uint32_t node = this->open_list.pop();
+        PLANNER_STAT(this->stats.abstract_nodes_expanded++);
+        if (node == goal_node)
+        {
+            path_found = true;
+            break;
+        }
+        for (const Edge &edge : this->nodes[node].edges)
+            relax_node(edge.to, this->g[node] + edge.cost, node, goal);
+        if (this->nodes[node].cluster == goal_cluster)
+        {
+            double distance = cluster_distance(goal_cluster, this->nodes[node].cell);
+            if (distance != INFINITE_COST)
+                relax_node(goal_node, this->g[node] + distance, node, goal);
+        }
+    }
+    if (!path_found)
+        return 0;
+
+    this->waypoints.assign(1, goal);
+    for (std::uint32_t node = this->came_from[goal_node]; node != NO_NODE; node = this->came_from[node])
+        this->waypoints.push_back(this->nodes[node].cell);
+    this->waypoints.push_back(start);
+    std::reverse(this->waypoints.begin(), this->waypoints.end());
+    PLANNER_STAT(this->stats.search_ns = elapsed_ns(phase_begin));
+
+    PLANNER_STAT(phase_begin = std::chrono::steady_clock::now());
+    bool refined = refine();
+    PLANNER_STAT(this->stats.extract_ns = elapsed_ns(phase_begin));
+    if (!refined)
+        return 0;
+    this->stats.path_length = this->path.size();
+    return this->stats.path_length;
+}
+
+/* -------------------------------- MAP EDITS ------------------------------- */
+/**
+ * @brief Block a cell of the map; its cluster is rebuilt by the next plan()
+ *
+ * @param y 0-based, like GridMap and ComponentIndex
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the grid
+ */
+void HpaStar::add_obstacle(std::uint32_t y, std::uint32_t x)
+{
+    if (!this->map->in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    std::uint32_t cell = this->map->index(y, x);
+    if (this->map->data()[cell] == BLOCK_OBSTACLE)
+        return;
+    bool current = this->built && this->version == this->map->get_version();
+    this->map->data()[cell] = BLOCK_OBSTACLE;
+    this->map->mark_modified();
+    if (current)
+    {
+        this->version = this->map->get_version();
+        mark_dirty(cell);
+    }
+}
+
+/**
+ * @brief Free a cell of the map; its cluster is rebuilt by the next plan()
+ *
+ * @param y 0-based, like GridMap and ComponentIndex
+ * @param x 0-based
+ * @throw std::out_of_range if the cell lies outside the grid
+ */
+void HpaStar::remove_obstacle(std::uint32_t y, std::uint32_t x)
+{
+    if (!this->map->in_bounds(y, x))
+        throw std::out_of_range("Cell outside the grid");
+    std::uint32_t cell = this->map->index(y, x);
+    if (this->map->data()[cell] != BLOCK_OBSTACLE)
+        return;
+    bool current = this->built && this->version == this->map->get_version();
+    this->map->data()[cell] = BLOCK_EMPTY;
+    this->map->mark_modified();
+    if (current)
+    {
+        this->version = this->map->get_version();
+        mark_dirty(cell);
+    }
+}
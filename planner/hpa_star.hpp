@@ -0,0 +1,151 @@
+/**
+ * @file hpa_star.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Hierarchical path planning (HPA*) over fixed-size clusters of the occupancy grid
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_HPA_STAR_HPP
+#define PLANNER_HPA_STAR_HPP
+
+#include "grid_map.hpp"
+#include "indexed_heap.hpp"
+#include "start_search.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define HPA_DEFAULT_CLUSTER_SIZE 16
+#define HPA_LONG_ENTRANCE 6 // Entrances at least this wide get a transition at both ends
+
+/**
+ * @brief Cost of the last plan() and size of the abstract graph
+ */
+struct HpaStats
+{
+    std::uint64_t abstract_nodes_expanded = 0; // Abstract nodes taken off the open list
+    std::uint64_t cells_expanded = 0;          // Cells expanded by the local searches and the refinement
+    std::uint32_t refined_segments = 0;        // Low-level searches run to refine the abstract path
+    std::uint32_t path_length = 0;             // Cells on the returned path, 0 if the plan failed
+    double path_cost = 0;                      // Summed move costs of the returned path
+    std::uint32_t clusters_rebuilt = 0;        // Clusters whose preprocessing was redone before the plan
+    std::uint64_t setup_ns = 0;                // Rebuilding edited clusters, linking start and goal
+    std::uint64_t search_ns = 0;               // A* over the abstract graph
+    std::uint64_t extract_ns = 0;              // Refining the abstract path into cells
+};
+
+/* ------------------------------ HPA* CLASS -------------------------------- */
+/**
+ * @brief Botea, Müller and Schaeffer's HPA* with one abstraction level
+ *
+ * The grid is cut into cluster_size x cluster_size clusters. Every border between two clusters is
+ * scanned for entrances (runs of free cells facing each other); each entrance gets one transition
+ * in its middle, or two at its ends when it is wide. With diagonal moves, crossings that no
+ * entrance covers (single diagonal steps, cluster corners) become transitions too, so the abstract
+ * graph connects exactly what the grid connects. The transition cells are the abstract nodes,
+ * joined across borders by one move and inside a cluster by their shortest cluster-local distance.
+ *
+ * plan() links start and goal into their clusters, runs A* on the abstract graph and refines
+ * every abstract edge of the result with a low-level A* (StartSearch). Long queries expand a
+ * number of abstract nodes that grows with the path, not with the map.
+ *
+ * add_obstacle() / remove_obstacle() edit the map and mark the cluster; the next plan() only redoes
+ * the entrances and distances of marked clusters and their neighbours. Edits made to the map behind
+ * the planner's back are caught through the map version and cost a full build(). Edits take 0-based
+ * cells like GridMap and ComponentIndex; plan() endpoints stay 1-based like StartSearch.
+ */
+class HpaStar
+{
+private:
+    /**
+     * @brief Abstract graph edge, a single move between clusters or a cluster-local shortest path
+     */
+    struct Edge
+    {
+        std::uint32_t to;
+        double cost;
+        bool inter; // Crosses a cluster border
+    };
+
+    /**
+     * @brief Transition cell of the abstract graph
+     */
+    struct Node
+    {
+        std::uint32_t cell;
+        std::uint32_t cluster;
+        std::uint32_t links; // Border transitions using the cell, the node is dropped at 0
+        std::vector<Edge> edges;
+    };
+
+    GridMap *map;                           // Map being planned on, owned by the caller
+    std::uint8_t connectivity;              // 4 or 8
+    std::uint32_t cluster_size;
+    MoveCosts move_costs;
+    std::uint32_t width, height, stride;
+    std::uint32_t cluster_rows, cluster_cols;
+    std::uint64_t version;                  // Map version the graph is valid for, dirty clusters aside
+    bool built;
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> free_nodes;                        // Slots of dropped nodes, reused first
+    std::unordered_map<std::uint32_t, std::uint32_t> node_at;     // Cell index -> node
+    std::vector<std::vector<std::uint32_t>> cluster_nodes;        // Nodes of every cluster
+    std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> border_links; // Node pairs of the 4 borders / corners owned by each cluster
+    std::vector<bool> dirty;                                      // Clusters edited since the last rebuild
+    std::vector<std::uint32_t> dirty_list;
+
+    std::vector<double> local_distance;     // Cluster-local Dijkstra distances, one slot per cluster cell
+    std::vector<std::uint32_t> local_stamp; // Query a local distance is valid for
+    std::uint32_t local_epoch;
+    IndexedHeap<double> local_open;
+
+    std::vector<double> g;                  // Abstract A* cost from the start, one slot per node plus the goal
+    std::vector<std::uint32_t> came_from;
+    std::vector<std::uint32_t> g_stamp;
+    std::uint32_t g_epoch;
+    IndexedHeap<double> open_list;
+    std::vector<std::uint32_t> waypoints;   // Abstract path cells of the last plan(), start first
+
+    StartSearch refiner;                    // Low-level A* between consecutive abstract nodes
+    GridPath path;                          // Cells of the last path, start first
+    HpaStats stats;                         // Statistics of the last plan()
+
+    std::uint32_t to_cell(std::uint32_t y, std::uint32_t x) const;
+    std::uint32_t cluster_of(std::uint32_t cell) const;
+    bool is_free(std::uint32_t cell) const { return this->map->data()[cell] != BLOCK_OBSTACLE; }
+    double heuristic(std::uint32_t from, std::uint32_t to) const;
+    std::uint32_t acquire_node(std::uint32_t cell);
+    void release_node(std::uint32_t node);
+    void link(std::uint32_t border, std::uint32_t cell_a, std::uint32_t cell_b, double cost);
+    void clear_border(std::uint32_t border);
+    void scan_border(std::uint32_t border, const std::vector<std::uint32_t> &side_a, const std::vector<std::uint32_t> &side_b);
+    void build_border(std::uint32_t border);
+    void search_cluster(std::uint32_t cluster, std::uint32_t source);
+    double cluster_distance(std::uint32_t cluster, std::uint32_t cell) const;
+    void connect_cluster(std::uint32_t cluster);
+    void relax_node(std::uint32_t node, double cost, std::uint32_t from, std::uint32_t goal);
+    void refresh(void);
+    void mark_dirty(std::uint32_t cell);
+    bool refine(void);
+
+public:
+    explicit HpaStar(GridMap &map, std::uint32_t cluster_size = HPA_DEFAULT_CLUSTER_SIZE, std::uint8_t connectivity = 8);
+    void set_move_costs(MoveCosts move_costs);
+    void build(void);
+    std::uint32_t plan(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x);
+    void add_obstacle(std::uint32_t y, std::uint32_t x);
+    void remove_obstacle(std::uint32_t y, std::uint32_t x);
+
+    std::uint32_t cluster_count(void) const { return cluster_rows * cluster_cols; }
+    std::uint32_t node_count(void) const { return nodes.size() - free_nodes.size(); }
+    const GridPath &get_path(void) const { return path; }
+    const HpaStats &get_stats(void) const { return stats; }
+};
+
+#endif // PLANNER_HPA_STAR_HPP
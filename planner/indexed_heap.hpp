@@ -0,0 +1,186 @@
+/**
+ * @file indexed_heap.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Addressable 4-ary min-heap over cell indices with decrease-key, key update and removal
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_INDEXED_HEAP_HPP
+#define PLANNER_INDEXED_HEAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define HEAP_NOT_QUEUED UINT32_MAX
+
+/**
+ * @brief Min-heap of items 0 .. capacity-1, each present at most once.
+ *
+ * position[item] tracks where an item sits in the heap so its key can be lowered in place
+ * (decrease-key) instead of pushing a duplicate. A 4-ary layout keeps the tree shallow and
+ * the children of a node on one cache line.
+ *
+ * @tparam Key Priority type, ordered by operator<
+ */
+template <typename Key>
+class IndexedHeap
+{
+private:
+    struct Entry
+    {
+        Key key;
+        std::uint32_t item;
+    };
+
+    std::vector<Entry> heap;             // Heap ordered entries
+    std::vector<std::uint32_t> position; // Slot of every item in heap, HEAP_NOT_QUEUED if absent
+    std::uint32_t peak = 0;              // Largest size since the last clear()
+
+    void sift_up(std::uint32_t slot)
+    {
+        Entry entry = heap[slot];
+        while (slot > 0)
+        {
+            std::uint32_t up = (slot - 1) / 4;
+            if (!(entry.key < heap[up].key))
+                break;
+            heap[slot] = heap[up];
+            position[heap[slot].item] = slot;
+            slot = up;
+        }
+        heap[slot] = entry;
+        position[entry.item] = slot;
+    }
+
+    void sift_down(std::uint32_t slot)
+    {
+        Entry entry = heap[slot];
+        std::uint32_t size = heap.size();
+        while (true)
+        {
+            std::uint32_t first = slot * 4 + 1;
+            if (first >= size)
+                break;
+            std::uint32_t last = first + 4 < size ? first + 4 : size;
+            std::uint32_t best = first;
+            for (std::uint32_t child = first + 1; child < last; child++)
+                if (heap[child].key < heap[best].key)
+                    best = child;
+            if (!(heap[best].key < entry.key))
+                break;
+            heap[slot] = heap[best];
+            position[heap[slot].item] = slot;
+            slot = best;
+        }
+        heap[slot] = entry;
+        position[entry.item] = slot;
+    }
+
+public:
+    /**
+     * @brief Size the heap for items 0 .. capacity-1. Allocates only when the capacity grows.
+     *
+     * @param capacity Number of addressable items
+     */
+    void reserve(std::uint32_t capacity)
+    {
+        if (position.size() < capacity)
+            position.resize(capacity, HEAP_NOT_QUEUED);
+        heap.reserve(capacity);
+    }
+
+    /**
+     * @brief Empty the heap in O(size), leaving the storage allocated
+     */
+    void clear(void)
+    {
+        for (const Entry &entry : heap)
+            position[entry.item] = HEAP_NOT_QUEUED;
+        heap.clear();
+        peak = 0;
+    }
+
+    bool empty(void) const { return heap.empty(); }
+    std::uint32_t size(void) const { return heap.size(); }
+    std::uint32_t peak_size(void) const { return peak; }
+    std::size_t bytes(void) const { return heap.capacity() * sizeof(Entry) + position.capacity() * sizeof(std::uint32_t); }
+    bool contains(std::uint32_t item) const { return position[item] != HEAP_NOT_QUEUED; }
+    const Key &top_key(void) const { return heap.front().key; }
+    std::uint32_t top(void) const { return heap.front().item; }
+    const Key &key_of(std::uint32_t item) const { return heap[position[item]].key; }
+
+    /**
+     * @brief Insert an item that is not queued yet
+     */
+    void push(std::uint32_t item, const Key &key)
+    {
+        heap.push_back(Entry{key, item});
+        sift_up(heap.size() - 1);
+        if (heap.size() > peak)
+            peak = heap.size();
+    }
+
+    /**
+     * @brief Lower the key of a queued item
+     */
+    void decrease_key(std::uint32_t item, const Key &key)
+    {
+        std::uint32_t slot = position[item];
+        heap[slot].key = key;
+        sift_up(slot);
+    }
+
+    /**
+     * @brief Set the key of a queued item, lower or higher than before
+     */
+    void update_key(std::uint32_t item, const Key &key)
+    {
+        std::uint32_t slot = position[item];
+        bool lower = key < heap[slot].key;
+        heap[slot].key = key;
+        if (lower)
+            sift_up(slot);
+        else
+            sift_down(slot);
+    }
+
+    /**
+     * @brief Take a queued item out of the heap
+     */
+    void remove(std::uint32_t item)
+    {
+        std::uint32_t slot = position[item];
+        position[item] = HEAP_NOT_QUEUED;
+        Entry last = heap.back();
+        heap.pop_back();
+        if (slot < heap.size())
+        {
+            heap[slot] = last;
+            sift_up(slot);
+            sift_down(position[last.item]);
+        }
+    }
+
+    /**
+     * @brief Remove and return the item with the smallest key
+     */
+    std::uint32_t pop(void)
+    {
+        std::uint32_t item = heap.front().item;
+        position[item] = HEAP_NOT_QUEUED;
+        Entry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+        {
+            heap.front() = last;
+            sift_down(0);
+        }
+        return item;
+    }
+};
+
+#endif // PLANNER_INDEXED_HEAP_HPP
@@ -0,0 +1,385 @@
+/**
+ * @file jump_point_search.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Jump Point Search (JPS) and JPS+ for StartSearch on the uniform-cost 8-connected grid
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "start_search.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#define NO_JUMP_POINT UINT32_MAX
+
+/**
+ * @brief Jump table slot of each cardinal direction
+ */
+#define JUMP_EAST 0
+#define JUMP_WEST 1
+#define JUMP_SOUTH 2
+#define JUMP_NORTH 3
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Octile distance between two cells, the cost of the straight or diagonal segment joining two jump points
+ *
+ * @param from Cell index
+ * @param to Cell index
+ * @return double Segment cost
+ */
+inline double StartSearch::octile_distance(std::uint32_t from, std::uint32_t to)
+{
+    std::uint32_t dy = std::abs(static_cast<std::int64_t>(from / this->stride) - static_cast<std::int64_t>(to / this->stride));
+    std::uint32_t dx = std::abs(static_cast<std::int64_t>(from % this->stride) - static_cast<std::int64_t>(to % this->stride));
+    return this->move_costs.straight * (dx + dy) + (this->move_costs.diagonal - 2 * this->move_costs.straight) * std::min(dx, dy);
+}
+
+/**
+ * @brief Check whether a cell reached by a straight move has a forced neighbour
+ *
+ * Moving along x, a blocked cell above or below with an open cell diagonally ahead of it can only
+ * be reached optimally through this cell. The same holds transposed when moving along y.
+ *
+ * @param y
+ * @param x
+ * @param dy Move direction along y (-1, 0, 1)
+ * @param dx Move direction along x (-1, 0, 1)
+ */
+inline bool StartSearch::has_forced_neighbour(std::int64_t y, std::int64_t x, int dy, int dx)
+{
+    if (dx != 0)
+        return (!is_passable(y - 1, x) && is_passable(y - 1, x + dx)) || (!is_passable(y + 1, x) && is_passable(y + 1, x + dx));
+    return (!is_passable(y, x - 1) && is_passable(y + dy, x - 1)) || (!is_passable(y, x + 1) && is_passable(y + dy, x + 1));
+}
+
+/* ------------------------------- JUMP TABLE ------------------------------- */
+/**
+ * @brief Precompute the JPS+ jump distances of the four cardinal directions for every cell
+ *
+ * A positive entry k means the k-th cell in that direction is a jump point (it has a forced
+ * neighbour); an entry -k (k >= 0) means k passable cells follow before a wall and none of them
+ * is a jump point. The table remembers the map version it was built for; jps_search() rebuilds it
+ * once the obstacles change.
+ */
+void StartSearch::prepare_jump_table(void)
+{
+    bind_grid(); // The map may have a new buffer since the last search (load_map, adopt)
+    this->jump_table.assign(static_cast<std::size_t>(this->cell_total) * 4, 0);
+    this->jump_table_version = this->bound_version; // The version of the cells the table is built from
+
+    for (std::int64_t y = 0; y < this->height; y++)
+    {
+        for (std::int64_t x = static_cast<std::int64_t>(this->width) - 1; x >= 0; x--) // East, scanned from the east edge
+        {
+            std::int32_t &entry = this->jump_table[static_cast<std::size_t>(cell_index(y, x)) * 4 + JUMP_EAST];
+            if (!is_passable(y, x + 1))
+                entry = 0;
+            else if (has_forced_neighbour(y, x + 1, 0, 1))
+                entry = 1;
+            else
+            {
+                std::int32_t next = this->jump_table[static_cast<std::size_t>(cell_index(y, x + 1)) * 4 + JUMP_EAST];
+                entry = next > 0 ? next + 1 : next - 1;
+            }
+        }
+        for (std::int64_t x = 0; x < this->width; x++) // West, scanned from the west edge
+        {
+            std::int32_t &entry = this->jump_table[static_cast<std::size_t>(cell_index(y, x)) * 4 + JUMP_WEST];
+            if (!is_passable(y, x - 1))
+                entry = 0;
+            else if (has_forced_neighbour(y, x - 1, 0, -1))
+                entry = 1;
+            else
+            {
+                std::int32_t next = this->jump_table[static_cast<std::size_t>(cell_index(y, x - 1)) * 4 + JUMP_WEST];
+                entry = next > 0 ? next + 1 : next - 1;
+            }
+        }
+    }
+
+    for (std::int64_t x = 0; x < this->width; x++)
+    {
+        for (std::int64_t y = static_cast<std::int64_t>(this->height) - 1; y >= 0; y--) // South, scanned from the bottom edge
+        {
+            std::int32_t &entry = this->jump_table[static_cast<std::size_t>(cell_index(y, x)) * 4 + JUMP_SOUTH];
+            if (!is_passable(y + 1, x))
+                entry = 0;
+            else if (has_forced_neighbour(y + 1, x, 1, 0))
+                entry = 1;
+            else
+            {
+                std::int32_t next = this->jump_table[static_cast<std::size_t>(cell_index(y + 1, x)) * 4 + JUMP_SOUTH];
+                entry = next > 0 ? next + 1 : next - 1;
+            }
+        }
+        for (std::int64_t y = 0; y < this->height; y++) // North, scanned from the top edge
+        {
+            std::int32_t &entry = this->jump_table[static_cast<std::size_t>(cell_index(y, x)) * 4 + JUMP_NORTH];
+            if (!is_passable(y - 1, x))
+                entry = 0;
+            else if (has_forced_neighbour(y - 1, x, -1, 0))
+                entry = 1;
+            else
+            {
+                std::int32_t next = this->jump_table[static_cast<std::size_t>(cell_index(y - 1, x)) * 4 + JUMP_NORTH];
+                entry = next > 0 ? next + 1 : next - 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Straight jump answered from the JPS+ table in O(1)
+ *
+ * @param y
+ * @param x
+ * @param dy Move direction along y, 0 when moving along x
+ * @param dx Move direction along x, 0 when moving along y
+ * @return std::uint32_t Jump point or goal cell index, NO_JUMP_POINT if the ray hits a wall first
+ */
+inline std::uint32_t StartSearch::jump_from_table(std::int64_t y, std::int64_t x, int dy, int dx)
+{
+    int slot = (dx > 0) ? JUMP_EAST : (dx < 0) ? JUMP_WEST
+                                  : (dy > 0)   ? JUMP_SOUTH
+                                               : JUMP_NORTH;
+    std::int32_t entry = this->jump_table[static_cast<std::size_t>(cell_index(y, x)) * 4 + slot];
+    std::int32_t reach = entry > 0 ? entry : -entry;
+    PLANNER_STAT(this->stats.cells_scanned++);
+
+    // The goal on the ray is reached before whatever the table points at
+    std::int64_t goal_y = end_pos[0];
+    std::int64_t goal_x = end_pos[1];
+    std::int64_t goal_steps = -1;
+    if (dx != 0 && goal_y == y && (goal_x - x) * dx > 0)
+        goal_steps = (goal_x - x) * dx;
+    else if (dy != 0 && goal_x == x && (goal_y - y) * dy > 0)
+        goal_steps = (goal_y - y) * dy;
+    if (goal_steps > 0 && goal_steps <= reach)
+        return cell_index(goal_y, goal_x);
+
+    if (entry > 0)
+        return cell_index(y + dy * entry, x + dx * entry);
+    return NO_JUMP_POINT;
+}
+
+/* ---------------------------------- JUMP ---------------------------------- */
+/**
+ * @brief Move from (y,x) in one direction until a jump point, the goal or a wall is met
+ *
+ * A diagonal step is a jump point if it has a forced neighbour or if a straight jump along
+ * either of its components finds one.
+ *
+ * @param y
+ * @param x
+ * @param dy Move direction along y (-1, 0, 1)
+ * @param dx Move direction along x (-1, 0, 1)
+ * @return std::uint32_t Jump point or goal cell index, NO_JUMP_POINT if there is none
+ */
+std::uint32_t StartSearch::jump(std::int64_t y, std::int64_t x, int dy, int dx)
+{
+    if (this->use_jump_table && (dx == 0 || dy == 0))
+        return jump_from_table(y, x, dy, dx);
+
+    while (true)
+    {
+        y += dy;
+        x += dx;
+        if (!is_passable(y, x))
+            return NO_JUMP_POINT;
+        PLANNER_STAT(this->stats.cells_scanned++);
+
+        if ((y == end_pos[0]) && (x == end_pos[1]))
+            return cell_index(y, x);
+
+        if (dx != 0 && dy != 0)
+        {
+            if ((!is_passable(y, x - dx) && is_passable(y + dy, x - dx)) || (!is_passable(y - dy, x) && is_passable(y - dy, x + dx)))
+                return cell_index(y, x);
+            if (jump(y, x, 0, dx) != NO_JUMP_POINT || jump(y, x, dy, 0) != NO_JUMP_POINT)
+                return cell_index(y, x);
+        }
+        else if (has_forced_neighbour(y, x, dy, dx))
+            return cell_index(y, x);
+    }
+}
+
+/**
+ * @brief Jump in one direction from cell and relax the jump point found, if any
+ *
+ * @param cell Jump point being expanded
+ * @param dy Move direction along y
+ * @param dx Move direction along x
+ */
+inline void StartSearch::jump_and_relax(std::uint32_t cell, int dy, int dx)
+{
+    std::uint32_t jump_point = jump(cell / this->stride, cell % this->stride, dy, dx);
+    if (jump_point == NO_JUMP_POINT)
+        return;
+    if (is_closed(jump_point)) // Already settled
+        return;
+    relax_astar_neighbour(cell, jump_point, this->distance_list[cell] + octile_distance(cell, jump_point));
+}
+
+/* ------------------------- PATH PLOTTING FUNCTION ------------------------- */
+/**
+ * @brief Rebuild the cell path from the chain of jump points
+ *
+ * Consecutive jump points always lie on one straight or diagonal line, so the cells between them
+ * are filled in by stepping along that line.
+ *
+ * @param goal Cell index of the goal
+ * @return std::uint32_t Number of cells on the path
+ */
+std::uint32_t StartSearch::extract_jump_path(std::uint32_t goal)
+{
+    PLANNER_STAT(auto extract_begin = std::chrono::steady_clock::now());
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+
+    std::uint32_t length = 1;
+    for (std::uint32_t cell = goal; cell != start; cell = this->parent[cell])
+    {
+        std::uint32_t from = this->parent[cell];
+        length += std::max(std::abs(static_cast<std::int64_t>(cell / this->stride) - static_cast<std::int64_t>(from / this->stride)),
+                           std::abs(static_cast<std::int64_t>(cell % this->stride) - static_cast<std::int64_t>(from % this->stride)));
+    }
+
+    this->path.cells.resize(length);
+    std::uint32_t pos = length;
+    std::uint32_t cell = goal;
+    while (true)
+    {
+        std::int64_t y = cell / this->stride;
+        std::int64_t x = cell % this->stride;
+        if (cell == start)
+        {
+            this->path.cells[0] = cell;
+            break;
+        }
+
+        // Step back along the segment towards the previous jump point
+        std::uint32_t from = this->parent[cell];
+        std::int64_t from_y = from / this->stride;
+        std::int64_t from_x = from % this->stride;
+        int dy = (from_y > y) - (from_y < y);
+        int dx = (from_x > x) - (from_x < x);
+        while (y != from_y || x != from_x)
+        {
+            pos--;
+            this->path.cells[pos] = y * this->stride + x;
+            y += dy;
+            x += dx;
+        }
+        cell = from;
+    }
+
+    this->cell_count = length; // Update the list count
+    PLANNER_STAT(this->stats.extract_ns += elapsed_ns(extract_begin));
+    return this->cell_count;
+}
+
+/* --------------------------- JUMP POINT SEARCH ---------------------------- */
+/**
+ * @brief Perform Jump Point Search
+ *
+ * A* over jump points only. From each jump point the search continues in the natural and forced
+ * directions relative to the direction it was reached from, which prunes the symmetric paths an
+ * 8-connected uniform-cost grid is full of. Paths are optimal under the same moves and costs as
+ * dijkstra_search (a diagonal step only needs the diagonal cell to be free).
+ *
+ * @param use_jump_table True -> JPS+, straight jumps are read from the precomputed jump table
+ *                          False -> JPS, every jump scans the grid
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::jps_search(bool use_jump_table)
+{
+    bool path_found = false; // Boolean to determine whether the path is found or not
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+
+    this->use_jump_table = use_jump_table;
+    if (use_jump_table && (this->jump_table.empty() || this->jump_table_version != this->map->get_version()))
+        prepare_jump_table();
+    this->active_heuristic = HEURISTIC_OCTILE;
+
+    this->astar_open_list.clear();
+
+    // Push the Start Node into the queue, its own parent at distance 'zero'
+    this->distance_list[start] = 0;
+    this->parent[start] = start;
+    mark_reached(start);
+    this->astar_open_list.push(start, AStarKey{heuristic(start), 0});
+    PLANNER_STAT(this->stats.nodes_pushed++);
+
+    while (!this->astar_open_list.empty())
+    {
+        // Pop the jump point with the lowest f, its g is final
+        std::uint32_t cell = this->astar_open_list.pop();
+        std::int64_t y = cell / this->stride;
+        std::int64_t x = cell % this->stride;
+
+        mark_closed(cell_index(y, x)); // Mark the Node as settled
+        PLANNER_STAT(this->stats.nodes_settled++);
+        expand_cell(y, x);
+
+        if (cell == goal) // Break if end point is reached
+        {
+            path_found = true;
+            break;
+        }
+
+        if (cell == start) // No direction yet, every neighbour is natural
+        {
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dx = -1; dx <= 1; dx++)
+                    if (dy != 0 || dx != 0)
+                        jump_and_relax(cell, dy, dx);
+            continue;
+        }
+
+        // Direction of travel into this jump point
+        std::uint32_t from = this->parent[cell];
+        int dy = (y > static_cast<std::int64_t>(from / this->stride)) - (y < static_cast<std::int64_t>(from / this->stride));
+        int dx = (x > static_cast<std::int64_t>(from % this->stride)) - (x < static_cast<std::int64_t>(from % this->stride));
+
+        if (dx != 0 && dy != 0) // Diagonal: both components, the diagonal and the forced diagonals
+        {
+            jump_and_relax(cell, 0, dx);
+            jump_and_relax(cell, dy, 0);
+            jump_and_relax(cell, dy, dx);
+            if (!is_passable(y, x - dx))
+                jump_and_relax(cell, dy, -dx);
+            if (!is_passable(y - dy, x))
+                jump_and_relax(cell, -dy, dx);
+        }
+        else if (dx != 0) // Horizontal: straight on and the forced diagonals
+        {
+            jump_and_relax(cell, 0, dx);
+            if (!is_passable(y - 1, x))
+                jump_and_relax(cell, -1, dx);
+            if (!is_passable(y + 1, x))
+                jump_and_relax(cell, 1, dx);
+        }
+        else // Vertical: straight on and the forced diagonals
+        {
+            jump_and_relax(cell, dy, 0);
+            if (!is_passable(y, x - 1))
+                jump_and_relax(cell, dy, -1);
+            if (!is_passable(y, x + 1))
+                jump_and_relax(cell, dy, 1);
+        }
+    }
+    PLANNER_STAT(this->stats.peak_frontier = this->astar_open_list.peak_size());
+
+    std::uint32_t steps = 0;
+    if (path_found)
+    {
+        this->stats.path_cost = this->distance_list[goal];
+        steps = extract_jump_path(goal); // Walk the jump points back to the start
+    }
+    return steps;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file landmark_table.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Landmark distance tables for the ALT (A*, Landmarks, Triangle inequality) heuristic
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "landmark_table.hpp"
+#include "common.hpp"
+#include "indexed_heap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#define LANDMARK_UNREACHED UINT32_MAX
+
+/**
+ * @brief Neighbour offsets, the four straight moves first
+ */
+static const int NEIGHBOUR_DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+static const int NEIGHBOUR_DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+
+/* ------------------------------- CONSTRUCTOR ------------------------------ */
+/**
+ * @brief Construct an empty table; build() fills it
+ *
+ * @param connectivity 4 -> straight moves only, 8 -> straight and diagonal moves
+ * @throw std::invalid_argument for another connectivity
+ */
+LandmarkTable::LandmarkTable(std::uint8_t connectivity)
+{
+    if (connectivity != 4 && connectivity != 8)
+        throw std::invalid_argument("Connectivity must be 4 or 8");
+    this->connectivity = connectivity;
+    this->map = nullptr;
+    this->version = 0;
+    this->count = 0;
+    this->straight_units = LANDMARK_UNITS;
+    this->diagonal_units = 0;
+    this->units_per_cost = 0;
+}
+
+/**
+ * @brief Set the price of straight and diagonal moves; takes effect at the next build()
+ *
+ * @param move_costs Positive straight and diagonal move costs
+ */
+void LandmarkTable::set_move_costs(MoveCosts move_costs)
+{
+    this->move_costs = move_costs;
+}
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Dijkstra from one free cell with the integer move costs of the table
+ *
+ * @param distance Filled with the distance of every cell, LANDMARK_UNREACHED if unreached
+ */
+void LandmarkTable::flood(const GridMap &map, std::uint32_t source, std::vector<std::uint32_t> &distance) const
+{
+    const std::uint8_t *cells = map.data();
+    IndexedHeap<std::uint32_t> open_list;
+    open_list.reserve(map.cell_count());
+    distance.assign(map.cell_count(), LANDMARK_UNREACHED);
+
+    distance[source] = 0;
+    open_list.push(source, 0);
+    while (!open_list.empty())
+    {
+        std::uint32_t cell = open_list.pop();
+        std::int64_t y = cell / map.get_stride();
+        std::int64_t x = cell % map.get_stride();
+        for (std::uint8_t dir = 0; dir < this->connectivity; dir++)
+        {
+            std::int64_t neighbour_y = y + NEIGHBOUR_DY[dir];
+            std::int64_t neighbour_x = x + NEIGHBOUR_DX[dir];
+            if (!map.in_bounds(neighbour_y, neighbour_x))
+                continue;
+            std::uint32_t neighbour = map.index(neighbour_y, neighbour_x);
+            if (cells[neighbour] == BLOCK_OBSTACLE)
+                continue;
+            std::uint64_t through = static_cast<std::uint64_t>(distance[cell]) + ((dir < 4) ? this->straight_units : this->diagonal_units);
+            if (through >= distance[neighbour])
+                continue;
+            distance[neighbour] = through; // Below LANDMARK_UNREACHED, checked above
+            if (open_list.contains(neighbour))
+                open_list.decrease_key(neighbour, through);
+            else
+                open_list.push(neighbour, through);
+        }
+    }
+}
+
+/* ---------------------------- BUILD FUNCTIONS ----------------------------- */
+/**
+ * @brief Pick landmarks farthest-point first and store their distances to every cell
+ *
+ * The first landmark is the cell farthest from the first free cell of the map. Fewer landmarks
+ * are kept when every reached cell already is one.
+ *
+ * @param map Map to index, must outlive the table while it is used
+ * @param landmark_count Landmarks to pick, K
+ * @throw std::invalid_argument for a landmark count of 0
+ */
+void LandmarkTable::build(const GridMap &map, std::uint32_t landmark_count)
+{
+    if (landmark_count == 0)
+        throw std::invalid_argument("At least one landmark is needed");
+
+    this->map = &map;
+    this->version = map.get_version();
+    this->straight_units = LANDMARK_UNITS;
+    this->diagonal_units = std::max<std::uint32_t>(1, std::floor(LANDMARK_UNITS * this->move_costs.diagonal / this->move_costs.straight));
+    this->units_per_cost = LANDMARK_UNITS / this->move_costs.straight;
+    this->landmarks.clear();
+    this->table_16.clear();
+    this->table_32.clear();
+    this->count = 0;
+
+    const std::uint8_t *cells = map.data();
+    std::uint32_t cell_total = map.cell_count();
+    std::uint32_t seed = 0;
+    while (seed < cell_total && (cells[seed] == BLOCK_OBSTACLE || seed % map.get_stride() >= map.get_width()))
+        seed++;
+    if (seed == cell_total)
+        return; // No free cell, an empty table bounds nothing
+
+    std::vector<std::uint32_t> distance, nearest;
+    flood(map, seed, nearest);
+    std::vector<std::uint32_t> rows; // Landmark-major while building
+    while (this->landmarks.size() < landmark_count)
+    {
+        // Reached cell farthest from every landmark so far
+        std::uint32_t next = seed, farthest = 0;
+        for (std::uint32_t cell = 0; cell < cell_total; cell++)
+            if (nearest[cell] != LANDMARK_UNREACHED && nearest[cell] > farthest)
+            {
+                farthest = nearest[cell];
+                next = cell;
+            }
+        if (!this->landmarks.empty() && farthest == 0)
+            break;
+
+        this->landmarks.push_back(next);
+        flood(map, next, distance);
+        rows.insert(rows.end(), distance.begin(), distance.end());
+        if (this->landmarks.size() == 1)
+            nearest = distance;
+        else
+            for (std::uint32_t cell = 0; cell < cell_total; cell++)
+                nearest[cell] = std::min(nearest[cell], distance[cell]);
+    }
+    this->count = this->landmarks.size();
+
+    // Transpose to cell-major, in 16 bits when the farthest reached distance fits below the marker
+    std::uint32_t largest = 0;
+    for (std::uint32_t value : rows)
+        if (value != LANDMARK_UNREACHED)
+            largest = std::max(largest, value);
+    if (largest < UINT16_MAX)
+    {
+        this->table_16.resize(static_cast<std::size_t>(cell_total) * this->count);
+        for (std::uint32_t landmark = 0; landmark < this->count; landmark++)
+            for (std::uint32_t cell = 0; cell < cell_total; cell++)
+            {
+                std::uint32_t value = rows[static_cast<std::size_t>(landmark) * cell_total + cell];
+                this->table_16[static_cast<std::size_t>(cell) * this->count + landmark] = (value == LANDMARK_UNREACHED) ? UINT16_MAX : value;
+            }
+    }
+    else
+    {
+        this->table_32.resize(static_cast<std::size_t>(cell_total) * this->count);
+        for (std::uint32_t landmark = 0; landmark < this->count; landmark++)
+            for (std::uint32_t cell = 0; cell < cell_total; cell++)
+                this->table_32[static_cast<std::size_t>(cell) * this->count + landmark] = rows[static_cast<std::size_t>(landmark) * cell_total + cell];
+    }
+}
+
+/**
+ * @brief Check whether the table was built for the current contents of map
+ */
+bool LandmarkTable::is_current(const GridMap &map) const
+{
+    return this->map == &map && this->version == map.get_version();
+}
+
+/* ----------------------------- LOOKUP FUNCTION ---------------------------- */
+/**
+ * @brief Triangle-inequality lower bound of the cost between two cells
+ *
+ * Landmarks that do not reach both cells are skipped.
+ *
+ * @param cell Cell index
+ * @param goal Cell index
+ * @return double max over the landmarks of |d(L,goal) - d(L,cell)|, in move costs
+ */
+double LandmarkTable::lower_bound(std::uint32_t cell, std::uint32_t goal) const
+{
+    std::uint32_t best = 0;
+    if (this->table_32.empty())
+    {
+        const std::uint16_t *from = &this->table_16[static_cast<std::size_t>(cell) * this->count];
+        const std::uint16_t *to = &this->table_16[static_cast<std::size_t>(goal) * this->count];
+        for (std::uint32_t landmark = 0; landmark < this->count; landmark++)
+        {
+            if (from[landmark] == UINT16_MAX || to[landmark] == UINT16_MAX)
+                continue;
+            std::uint32_t gap = (from[landmark] > to[landmark]) ? from[landmark] - to[landmark] : to[landmark] - from[landmark];
+            best = std::max(best, gap);
+        }
+    }
+    else
+    {
+        const std::uint32_t *from = &this->table_32[static_cast<std::size_t>(cell) * this->count];
+        const std::uint32_t *to = &this->table_32[static_cast<std::size_t>(goal) * this->count];
+        for (std::uint32_t landmark = 0; landmark < this->count; landmark++)
+        {
+            if (from[landmark] == LANDMARK_UNREACHED || to[landmark] == LANDMARK_UNREACHED)
+                continue;
+            std::uint32_t gap = (from[landmark] > to[landmark]) ? from[landmark] - to[landmark] : to[landmark] - from[landmark];
+            best = std::max(best, gap);
+        }
+    }
+    return best / this->units_per_cost;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file landmark_table.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Landmark distance tables for the ALT (A*, Landmarks, Triangle inequality) heuristic
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_LANDMARK_TABLE_HPP
+#define PLANNER_LANDMARK_TABLE_HPP
+
+#include "grid_map.hpp"
+#include "start_search.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define LANDMARK_UNITS 32 // Table units per straight move
+#define LANDMARK_DEFAULT_COUNT 8
+
+/* ------------------------- LANDMARK TABLE CLASS -------------------------- */
+/**
+ * @brief Exact distances from K landmarks to every free cell, for the bound |d(L,goal) - d(L,cell)|
+ *
+ * Landmarks are picked farthest-point first: each one is the reached cell farthest from the
+ * landmarks chosen before it, so they end up in the corners and dead ends where the bound is tight.
+ *
+ * Distances are stored in integer units, LANDMARK_UNITS per straight move and the diagonal cost
+ * rounded down, and flooded with those integer costs. Every integer move costs at most the real
+ * one, so the bound stays admissible and consistent for the move costs of the build. Entries are
+ * 16-bit when the farthest distance fits, 32-bit otherwise, laid out cell-major so a lookup reads
+ * the K entries of a cell together.
+ *
+ * Lookups are const and may run from many threads; the table is only trusted while the map is
+ * unchanged.
+ */
+class LandmarkTable
+{
+private:
+    std::uint8_t connectivity;            // 4 or 8
+    MoveCosts move_costs;                 // Prices the table is built for
+    const GridMap *map;                   // Map of the last build
+    std::uint64_t version;                // Map version the table is valid for
+    std::uint32_t count;                  // Landmarks in the table
+    std::uint32_t straight_units, diagonal_units;
+    double units_per_cost;                // Table units per unit of move cost
+    std::vector<std::uint32_t> landmarks; // Cell index of every landmark
+    std::vector<std::uint16_t> table_16;  // cell * count + landmark, UINT16_MAX if unreached
+    std::vector<std::uint32_t> table_32;  // Same layout when a distance does not fit 16 bits
+
+    void flood(const GridMap &map, std::uint32_t source, std::vector<std::uint32_t> &distance) const;
+
+public:
+    explicit LandmarkTable(std::uint8_t connectivity = 8);
+    void set_move_costs(MoveCosts move_costs);
+    void build(const GridMap &map, std::uint32_t landmark_count = LANDMARK_DEFAULT_COUNT);
+    bool is_current(const GridMap &map) const;
+    double lower_bound(std::uint32_t cell, std::uint32_t goal) const;
+
+    std::uint8_t get_connectivity(void) const { return connectivity; }
+    const MoveCosts &get_move_costs(void) const { return move_costs; }
+    const std::vector<std::uint32_t> &get_landmarks(void) const { return landmarks; }
+    std::uint8_t entry_bytes(void) const { return table_32.empty() ? 2 : 4; }
+    std::size_t bytes(void) const { return table_16.size() * sizeof(std::uint16_t) + table_32.size() * sizeof(std::uint32_t); }
+};
+
+#endif // PLANNER_LANDMARK_TABLE_HPP
@@ -0,0 +1,151 @@
+/**
+ * @file latency_histogram.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Log-linear latency histogram shared by concurrent searches and dumped periodically
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+/**
+ * @brief Construct an empty histogram
+ */
+LatencyHistogram::LatencyHistogram(void)
+{
+    reset();
+}
+
+/**
+ * @brief Bucket of a value: shift * 32 + (ns >> shift), shift keeping the top 6 significant bits
+ */
+std::uint32_t LatencyHistogram::bucket_of(std::uint64_t ns)
+{
+    std::uint32_t magnitude = 63 - __builtin_clzll(ns | 1);
+    std::uint32_t shift = (magnitude > HISTOGRAM_SUB_BUCKET_BITS) ? magnitude - HISTOGRAM_SUB_BUCKET_BITS : 0;
+    if (shift > HISTOGRAM_MAX_SHIFT)
+        return HISTOGRAM_BUCKETS - 1;
+    return (shift << HISTOGRAM_SUB_BUCKET_BITS) + static_cast<std::uint32_t>(ns >> shift);
+}
+
+/**
+ * @brief Smallest value of a bucket
+ */
+std::uint64_t LatencyHistogram::bucket_floor(std::uint32_t bucket)
+{
+    std::uint32_t shift = (bucket >> HISTOGRAM_SUB_BUCKET_BITS);
+    shift = (shift > 0) ? shift - 1 : 0;
+    return static_cast<std::uint64_t>(bucket - (shift << HISTOGRAM_SUB_BUCKET_BITS)) << shift;
+}
+
+/**
+ * @brief Count one latency
+ *
+ * @param ns
+ */
+void LatencyHistogram::record(std::uint64_t ns)
+{
+    this->buckets[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+    this->total_count.fetch_add(1, std::memory_order_relaxed);
+    this->total_ns.fetch_add(ns, std::memory_order_relaxed);
+    std::uint64_t low = this->min_ns.load(std::memory_order_relaxed);
+    while (ns < low && !this->min_ns.compare_exchange_weak(low, ns, std::memory_order_relaxed))
+        ;
+    std::uint64_t high = this->max_ns.load(std::memory_order_relaxed);
+    while (ns > high && !this->max_ns.compare_exchange_weak(high, ns, std::memory_order_relaxed))
+        ;
+}
+
+/**
+ * @brief Add the counts of another histogram, e.g. one kept per thread
+ *
+ * @param other
+ */
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    for (std::uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+        this->buckets[bucket].fetch_add(other.buckets[bucket].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    this->total_count.fetch_add(other.count(), std::memory_order_relaxed);
+    this->total_ns.fetch_add(other.total_ns.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    std::uint64_t low = this->min_ns.load(std::memory_order_relaxed), other_low = other.min_ns.load(std::memory_order_relaxed);
+    while (other_low < low && !this->min_ns.compare_exchange_weak(low, other_low, std::memory_order_relaxed))
+        ;
+    std::uint64_t high = this->max_ns.load(std::memory_order_relaxed), other_high = other.max();
+    while (other_high > high && !this->max_ns.compare_exchange_weak(high, other_high, std::memory_order_relaxed))
+        ;
+}
+
+/**
+ * @brief Forget every value, e.g. after a periodic dump()
+ */
+void LatencyHistogram::reset(void)
+{
+    for (std::atomic<std::uint64_t> &bucket : this->buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    this->total_count.store(0, std::memory_order_relaxed);
+    this->total_ns.store(0, std::memory_order_relaxed);
+    this->min_ns.store(UINT64_MAX, std::memory_order_relaxed);
+    this->max_ns.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Smallest value recorded, 0 if empty
+ */
+std::uint64_t LatencyHistogram::min(void) const
+{
+    return (count() == 0) ? 0 : this->min_ns.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Mean of the values recorded, 0 if empty
+ */
+double LatencyHistogram::mean(void) const
+{
+    std::uint64_t values = count();
+    return (values == 0) ? 0 : static_cast<double>(this->total_ns.load(std::memory_order_relaxed)) / values;
+}
+
+/**
+ * @brief Value at or below which the given fraction of the values lie
+ *
+ * @param fraction In [0, 1], e.g. 0.99
+ * @return std::uint64_t Lower bound of the bucket holding the nearest-rank value, clamped to [min, max]; 0 if empty
+ */
+std::uint64_t LatencyHistogram::percentile(double fraction) const
+{
+    std::uint64_t values = count();
+    if (values == 0)
+        return 0;
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(fraction * values + 0.999999));
+    std::uint64_t seen = 0;
+    for (std::uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        seen += this->buckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return std::min(max(), std::max(min(), bucket_floor(bucket)));
+    }
+    return max();
+}
+
+/**
+ * @brief Write one line: count, mean, p50 / p90 / p99 / p99.9 and max in microseconds
+ *
+ * @param out
+ * @param label Name of the line, e.g. the search type
+ */
+void LatencyHistogram::dump(std::ostream &out, const std::string &label) const
+{
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << label << ": " << count() << " searches, mean " << std::fixed << std::setprecision(1) << mean() / 1e3
+        << " us, p50 " << percentile(0.50) / 1e3 << " us, p90 " << percentile(0.90) / 1e3
+        << " us, p99 " << percentile(0.99) / 1e3 << " us, p99.9 " << percentile(0.999) / 1e3
+        << " us, max " << max() / 1e3 << " us\n";
+    out.flags(flags);
+    out.precision(precision);
+}
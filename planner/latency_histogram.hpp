@@ -0,0 +1,61 @@
+/**
+ * @file latency_histogram.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Log-linear latency histogram shared by concurrent searches and dumped periodically
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_LATENCY_HISTOGRAM_HPP
+#define PLANNER_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#define HISTOGRAM_SUB_BUCKET_BITS 5 // 32 linear buckets per power of two, values within 1/32 (about 3%)
+#define HISTOGRAM_MAX_SHIFT 35      // Values up to 2^41 ns (about 36 minutes), longer ones land in the last bucket
+#define HISTOGRAM_BUCKETS (((HISTOGRAM_MAX_SHIFT + 2) << HISTOGRAM_SUB_BUCKET_BITS))
+
+/* --------------------------- LATENCY HISTOGRAM ---------------------------- */
+/**
+ * @brief HDR-style histogram of nanosecond latencies
+ *
+ * Values below 64 get a bucket each; above, every power of two is split into 32 equal buckets,
+ * so a percentile is exact to about 3% over the whole range in a fixed 9.5 KiB. Buckets are
+ * relaxed atomics: any number of threads (e.g. the workers of a BatchSearch) record into one
+ * histogram, and a reporting thread may dump() and reset() it while they run; a dump taken
+ * during recording may miss the values in flight.
+ */
+class LatencyHistogram
+{
+private:
+    std::atomic<std::uint64_t> buckets[HISTOGRAM_BUCKETS];
+    std::atomic<std::uint64_t> total_count;
+    std::atomic<std::uint64_t> total_ns;
+    std::atomic<std::uint64_t> min_ns;
+    std::atomic<std::uint64_t> max_ns;
+
+    static std::uint32_t bucket_of(std::uint64_t ns);
+    static std::uint64_t bucket_floor(std::uint32_t bucket);
+
+public:
+    LatencyHistogram(void);
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+    void record(std::uint64_t ns);
+    void merge(const LatencyHistogram &other);
+    void reset(void);
+    std::uint64_t count(void) const { return total_count.load(std::memory_order_relaxed); }
+    std::uint64_t min(void) const;
+    std::uint64_t max(void) const { return max_ns.load(std::memory_order_relaxed); }
+    double mean(void) const;
+    std::uint64_t percentile(double fraction) const;
+    void dump(std::ostream &out, const std::string &label) const;
+};
+
+#endif // PLANNER_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,134 @@
+/**
+ * @file map_file.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Versioned binary map files, saved from a GridMap and memory-mapped back without parsing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "map_file.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ull
+#define FNV_PRIME 0x100000001b3ull
+
+/**
+ * @brief 64-bit FNV-1a taken over 8-byte words, then over the remaining bytes
+ *
+ * @param data
+ * @param bytes
+ * @return std::uint64_t
+ */
+std::uint64_t map_checksum(const std::uint8_t *data, std::size_t bytes)
+{
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    std::size_t pos = 0;
+    for (; pos + 8 <= bytes; pos += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, data + pos, 8);
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; pos < bytes; pos++)
+        hash = (hash ^ data[pos]) * FNV_PRIME;
+    return hash;
+}
+
+/**
+ * @brief Write the map to a map file
+ *
+ * @param map
+ * @param path Replaced if it exists
+ * @throw std::runtime_error if the file cannot be written
+ */
+void save_map(const GridMap &map, const std::string &path)
+{
+    MapFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAP_FILE_MAGIC, sizeof(header.magic));
+    header.format_version = MAP_FILE_VERSION;
+    header.byte_order = MAP_FILE_BYTE_ORDER;
+    header.header_bytes = sizeof(header);
+    header.cell_bytes = 1;
+    header.width = map.get_width();
+    header.height = map.get_height();
+    header.stride = map.get_stride();
+    header.payload_offset = MAP_FILE_PAYLOAD_ALIGNMENT;
+    header.payload_bytes = map.cell_count();
+    header.checksum = map_checksum(map.data(), header.payload_bytes);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    std::vector<char> padding(header.payload_offset - sizeof(header), 0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(padding.data(), padding.size());
+    file.write(reinterpret_cast<const char *>(map.data()), header.payload_bytes);
+    file.close();
+    if (!file)
+        throw std::runtime_error("Cannot write map file " + path);
+}
+
+/**
+ * @brief Map a map file into memory and let the map search its payload in place
+ *
+ * Only the header is read: the payload is mapped copy-on-write, so loading costs one mmap()
+ * whatever the map size, pages are read on first touch, and planners editing the map (D* Lite,
+ * HPA*) change their private copy of a page, never the file.
+ *
+ * @param path
+ * @param map Adopts the mapping, see GridMap::adopt()
+ * @param verify_checksum Also hash the payload, which reads the whole file
+ * @throw std::runtime_error if the file cannot be mapped, is not a map file of this version,
+ *        is truncated, or fails the checksum
+ */
+void load_map(const std::string &path, GridMap &map, bool verify_checksum)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open map file " + path + ": " + std::strerror(errno));
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<std::size_t>(file_stat.st_size) < sizeof(MapFileHeader))
+    {
+        close(fd);
+        throw std::runtime_error("Map file " + path + " is truncated");
+    }
+    std::size_t file_bytes = file_stat.st_size;
+    void *base = mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        throw std::runtime_error("Cannot map map file " + path + ": " + std::strerror(errno));
+    std::shared_ptr<std::uint8_t> mapping(static_cast<std::uint8_t *>(base), [file_bytes](std::uint8_t *bytes)
+                                          { munmap(bytes, file_bytes); });
+
+    MapFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, MAP_FILE_MAGIC, sizeof(header.magic)) != 0)
+        throw std::runtime_error(path + " is not a map file");
+    if (header.byte_order != MAP_FILE_BYTE_ORDER)
+        throw std::runtime_error("Map file " + path + " was saved with the other byte order");
+    if (header.format_version != MAP_FILE_VERSION || header.header_bytes != sizeof(header) || header.cell_bytes != 1)
+        throw std::runtime_error("Map file " + path + " has format version " + std::to_string(header.format_version) +
+                                 ", expected " + std::to_string(MAP_FILE_VERSION));
+    if (header.payload_bytes != static_cast<std::uint64_t>(header.height) * header.stride ||
+        header.payload_offset % MAP_FILE_PAYLOAD_ALIGNMENT != 0 || header.payload_offset > file_bytes ||
+        header.payload_bytes > file_bytes - header.payload_offset)
+        throw std::runtime_error("Map file " + path + " is truncated");
+    if (verify_checksum && map_checksum(mapping.get() + header.payload_offset, header.payload_bytes) != header.checksum)
+        throw std::runtime_error("Map file " + path + " fails its checksum");
+
+    // Alias the payload, the deleter still unmaps the whole file
+    std::shared_ptr<std::uint8_t> payload(mapping, mapping.get() + header.payload_offset);
+    map.adopt(payload, header.width, header.height, header.stride);
+}
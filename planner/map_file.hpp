@@ -0,0 +1,52 @@
+/**
+ * @file map_file.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Versioned binary map files, saved from a GridMap and memory-mapped back without parsing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_MAP_FILE_HPP
+#define PLANNER_MAP_FILE_HPP
+
+#include "grid_map.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#define MAP_FILE_MAGIC "GRIDMAP"          // 8 bytes with the terminating NUL
+#define MAP_FILE_VERSION 1                // Bumped on any change of the layout below
+#define MAP_FILE_BYTE_ORDER 0x01020304u   // Read back as another value on a host of the other byte order
+#define MAP_FILE_PAYLOAD_ALIGNMENT 4096   // Payload starts on a page, so it maps straight into a GridMap
+
+/* ----------------------------- MAP FILE HEADER ---------------------------- */
+/**
+ * @brief Header at offset 0 of a map file, host byte order
+ *
+ * The payload follows at payload_offset: height * stride cells, one BLOCK_* byte each, row-major,
+ * exactly the buffer of a GridMap. The checksum (64-bit FNV-1a over 8-byte words) covers the payload.
+ */
+struct MapFileHeader
+{
+    char magic[8];
+    std::uint32_t format_version;
+    std::uint32_t byte_order;
+    std::uint32_t header_bytes;
+    std::uint32_t cell_bytes; // Bytes per cell of the payload, 1
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t stride;
+    std::uint32_t reserved;
+    std::uint64_t payload_offset;
+    std::uint64_t payload_bytes;
+    std::uint64_t checksum;
+};
+
+std::uint64_t map_checksum(const std::uint8_t *data, std::size_t bytes);
+void save_map(const GridMap &map, const std::string &path);
+void load_map(const std::string &path, GridMap &map, bool verify_checksum = false);
+
+#endif // PLANNER_MAP_FILE_HPP
@@ -0,0 +1,284 @@
+/**
+ * @file parallel_bfs.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Level-synchronous, direction-optimizing parallel BFS for full-map distance fields
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "parallel_bfs.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Work split of one level
+ */
+#define FRONTIER_CHUNK 1024 // Frontier cells per top-down task
+#define ROWS_PER_TASK 8     // Grid rows per bottom-up task
+
+/**
+ * @brief Default direction switch factors, from Beamer et al.
+ */
+#define DEFAULT_ALPHA 14
+#define DEFAULT_BETA 24
+
+/**
+ * @brief Construct the engine and its thread pool
+ *
+ * @param map Map to search, must outlive the engine and stay unchanged during a flood
+ * @param thread_count Workers including the calling thread, 0 -> one per hardware thread
+ */
+ParallelBFS::ParallelBFS(const GridMap &map, std::uint32_t thread_count) : pool(thread_count)
+{
+    this->map = &map;
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->words_per_row = 0;
+    this->bitmap_words = 0;
+    this->alpha = DEFAULT_ALPHA;
+    this->beta = DEFAULT_BETA;
+    this->next_frontier.resize(this->pool.size());
+    this->free_per_worker.resize(this->pool.size());
+}
+
+/**
+ * @brief Set the direction switch factors
+ *
+ * @param alpha Go bottom-up once frontier * alpha exceeds the unvisited cells
+ * @param beta Go back top-down once frontier * beta drops below the free cells
+ */
+void ParallelBFS::set_switch_factors(std::uint32_t alpha, std::uint32_t beta)
+{
+    this->alpha = alpha;
+    this->beta = beta;
+}
+
+/**
+ * @brief Read the dimensions of the map and size the bitmaps for it
+ */
+void ParallelBFS::bind_grid(void)
+{
+    this->width = this->map->get_width();
+    this->height = this->map->get_height();
+    this->stride = this->map->get_stride();
+    this->words_per_row = (this->width + 63) / 64;
+
+    std::size_t words = static_cast<std::size_t>(this->height) * this->words_per_row;
+    if (words != this->bitmap_words)
+    {
+        this->unvisited.reset(new std::atomic<std::uint64_t>[words]);
+        this->in_frontier.reset(new std::atomic<std::uint64_t>[words]);
+        this->bitmap_words = words;
+    }
+}
+
+/**
+ * @brief Expand the level from the frontier list: claim every unvisited neighbour once
+ *
+ * @param distance Distance field
+ * @param level Distance of the frontier cells
+ */
+void ParallelBFS::top_down_level(std::uint32_t *distance, std::uint32_t level)
+{
+    std::size_t chunks = (this->frontier.size() + FRONTIER_CHUNK - 1) / FRONTIER_CHUNK;
+    this->pool.parallel_for(chunks, [&](std::uint32_t worker, std::size_t chunk)
+                            {
+        std::vector<std::uint32_t> &found = this->next_frontier[worker];
+        std::size_t first = chunk * FRONTIER_CHUNK;
+        std::size_t last = std::min(first + FRONTIER_CHUNK, this->frontier.size());
+        for (std::size_t item = first; item < last; item++)
+        {
+            std::uint32_t cell = this->frontier[item];
+            std::int64_t y = cell / this->stride;
+            std::int64_t x = cell % this->stride;
+            const std::int64_t neighbour_y[4] = {y, y + 1, y, y - 1};
+            const std::int64_t neighbour_x[4] = {x + 1, x, x - 1, x};
+            for (std::uint8_t dir = 0; dir < 4; dir++)
+            {
+                if (!this->map->in_bounds(neighbour_y[dir], neighbour_x[dir]))
+                    continue;
+                std::atomic<std::uint64_t> &word = this->unvisited[neighbour_y[dir] * this->words_per_row + neighbour_x[dir] / 64];
+                std::uint64_t bit = std::uint64_t(1) << (neighbour_x[dir] % 64);
+                // Cheap read first; only the fetch_and that clears the bit owns the cell
+                if ((word.load(std::memory_order_relaxed) & bit) == 0)
+                    continue;
+                if ((word.fetch_and(~bit, std::memory_order_relaxed) & bit) == 0)
+                    continue;
+                std::uint32_t neighbour = neighbour_y[dir] * this->stride + neighbour_x[dir];
+                distance[neighbour] = level + 1;
+                found.push_back(neighbour);
+            }
+        } });
+}
+
+/**
+ * @brief Expand the level by testing every unvisited cell against the frontier bitmap
+ *
+ * Each task owns whole rows of the unvisited bitmap, so its words are updated without contention.
+ *
+ * @param distance Distance field
+ * @param level Distance of the frontier cells
+ */
+void ParallelBFS::bottom_up_level(std::uint32_t *distance, std::uint32_t level)
+{
+    std::size_t chunks = (this->frontier.size() + FRONTIER_CHUNK - 1) / FRONTIER_CHUNK;
+    auto mark_frontier = [&](bool set)
+    {
+        this->pool.parallel_for(chunks, [&](std::uint32_t, std::size_t chunk)
+                                {
+            std::size_t first = chunk * FRONTIER_CHUNK;
+            std::size_t last = std::min(first + FRONTIER_CHUNK, this->frontier.size());
+            for (std::size_t item = first; item < last; item++)
+            {
+                std::uint32_t cell = this->frontier[item];
+                std::uint32_t x = cell % this->stride;
+                std::atomic<std::uint64_t> &word = this->in_frontier[static_cast<std::size_t>(cell / this->stride) * this->words_per_row + x / 64];
+                if (set)
+                    word.fetch_or(std::uint64_t(1) << (x % 64), std::memory_order_relaxed);
+                else
+                    word.store(0, std::memory_order_relaxed);
+            }
+        });
+    };
+
+    mark_frontier(true);
+    std::size_t blocks = (this->height + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+    this->pool.parallel_for(blocks, [&](std::uint32_t worker, std::size_t block)
+                            {
+        std::vector<std::uint32_t> &found = this->next_frontier[worker];
+        std::uint32_t first = block * ROWS_PER_TASK;
+        std::uint32_t last = std::min<std::uint32_t>(first + ROWS_PER_TASK, this->height);
+        for (std::uint32_t y = first; y < last; y++)
+        {
+            std::size_t row = static_cast<std::size_t>(y) * this->words_per_row;
+            for (std::uint32_t w = 0; w < this->words_per_row; w++)
+            {
+                std::uint64_t candidates = this->unvisited[row + w].load(std::memory_order_relaxed);
+                if (candidates == 0)
+                    continue;
+
+                // Frontier cells left, right, above and below of every bit
+                std::uint64_t centre = this->in_frontier[row + w].load(std::memory_order_relaxed);
+                std::uint64_t touching = (centre << 1) | (centre >> 1);
+                if (w > 0)
+                    touching |= this->in_frontier[row + w - 1].load(std::memory_order_relaxed) >> 63;
+                if (w + 1 < this->words_per_row)
+                    touching |= this->in_frontier[row + w + 1].load(std::memory_order_relaxed) << 63;
+                if (y > 0)
+                    touching |= this->in_frontier[row - this->words_per_row + w].load(std::memory_order_relaxed);
+                if (y + 1 < this->height)
+                    touching |= this->in_frontier[row + this->words_per_row + w].load(std::memory_order_relaxed);
+
+                std::uint64_t hit = candidates & touching;
+                if (hit == 0)
+                    continue;
+                this->unvisited[row + w].store(candidates & ~hit, std::memory_order_relaxed);
+                for (; hit != 0; hit &= hit - 1)
+                {
+                    std::uint32_t cell = y * this->stride + w * 64 + __builtin_ctzll(hit);
+                    distance[cell] = level + 1;
+                    found.push_back(cell);
+                }
+            }
+        } });
+    mark_frontier(false);
+}
+
+/**
+ * @brief Make the cells found by all workers the new frontier
+ */
+void ParallelBFS::gather_frontier(void)
+{
+    this->frontier.clear();
+    for (std::vector<std::uint32_t> &found : this->next_frontier)
+    {
+        this->frontier.insert(this->frontier.end(), found.begin(), found.end());
+        found.clear();
+    }
+}
+
+/**
+ * @brief 4-connected BFS distance from the start to every cell
+ *
+ * @param start_y 0-based
+ * @param start_x 0-based
+ * @param distance Resized to height * stride of the map; PARALLEL_BFS_UNREACHED for cells that
+ *                 cannot be reached
+ * @return std::uint64_t Number of reachable cells, including the start; 0 if the start is blocked
+ *                       or outside the map
+ */
+std::uint64_t ParallelBFS::distance_field(std::uint32_t start_y, std::uint32_t start_x, std::vector<std::uint32_t> &distance)
+{
+    bind_grid();
+    this->stats = ParallelBFSStats();
+    distance.assign(static_cast<std::size_t>(this->height) * this->stride, PARALLEL_BFS_UNREACHED);
+    if (!this->map->in_bounds(start_y, start_x) || this->map->at(start_y, start_x) == BLOCK_OBSTACLE)
+        return 0;
+
+    // Pack the free cells into the unvisited bitmap, counting them per worker
+    std::fill(this->free_per_worker.begin(), this->free_per_worker.end(), 0);
+    std::size_t blocks = (this->height + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+    this->pool.parallel_for(blocks, [&](std::uint32_t worker, std::size_t block)
+                            {
+        std::uint32_t first = block * ROWS_PER_TASK;
+        std::uint32_t last = std::min<std::uint32_t>(first + ROWS_PER_TASK, this->height);
+        for (std::uint32_t y = first; y < last; y++)
+        {
+            const std::uint8_t *cells = this->map->data() + static_cast<std::size_t>(y) * this->stride;
+            for (std::uint32_t w = 0; w < this->words_per_row; w++)
+            {
+                std::uint64_t bits = 0;
+                std::uint32_t end = std::min<std::uint32_t>(64, this->width - w * 64);
+                for (std::uint32_t bit = 0; bit < end; bit++)
+                    if (cells[w * 64 + bit] != BLOCK_OBSTACLE)
+                        bits |= std::uint64_t(1) << bit;
+                std::size_t word = static_cast<std::size_t>(y) * this->words_per_row + w;
+                this->unvisited[word].store(bits, std::memory_order_relaxed);
+                this->in_frontier[word].store(0, std::memory_order_relaxed);
+                this->free_per_worker[worker] += __builtin_popcountll(bits);
+            }
+        } });
+    std::uint64_t free_cells = 0;
+    for (std::uint64_t count : this->free_per_worker)
+        free_cells += count;
+
+    std::uint32_t start = start_y * this->stride + start_x;
+    this->unvisited[static_cast<std::size_t>(start_y) * this->words_per_row + start_x / 64].fetch_and(~(std::uint64_t(1) << (start_x % 64)));
+    distance[start] = 0;
+    this->frontier.assign(1, start);
+    std::uint64_t unvisited_cells = free_cells - 1;
+    std::uint64_t reached = 1;
+
+    bool bottom_up = false;
+    for (std::uint32_t level = 0; !this->frontier.empty(); level++)
+    {
+        std::uint64_t frontier_size = this->frontier.size();
+        if (!bottom_up && frontier_size * this->alpha > unvisited_cells)
+            bottom_up = true;
+        else if (bottom_up && frontier_size * this->beta < free_cells)
+            bottom_up = false;
+
+        if (bottom_up)
+        {
+            bottom_up_level(distance.data(), level);
+            PLANNER_STAT(this->stats.bottom_up_levels++);
+        }
+        else
+        {
+            top_down_level(distance.data(), level);
+            PLANNER_STAT(this->stats.top_down_levels++);
+        }
+        PLANNER_STAT(this->stats.levels++);
+
+        gather_frontier();
+        unvisited_cells -= this->frontier.size();
+        reached += this->frontier.size();
+    }
+
+    this->stats.cells_reached = reached;
+    return reached;
+}
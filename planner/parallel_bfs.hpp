@@ -0,0 +1,77 @@
+/**
+ * @file parallel_bfs.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Level-synchronous, direction-optimizing parallel BFS for full-map distance fields
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_PARALLEL_BFS_HPP
+#define PLANNER_PARALLEL_BFS_HPP
+
+#include "grid_map.hpp"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#define PARALLEL_BFS_UNREACHED UINT32_MAX
+
+/**
+ * @brief How the last flood was run
+ */
+struct ParallelBFSStats
+{
+    std::uint32_t levels = 0;           // BFS levels expanded
+    std::uint32_t top_down_levels = 0;  // Levels expanded from the frontier list
+    std::uint32_t bottom_up_levels = 0; // Levels expanded by scanning the unvisited cells
+    std::uint64_t cells_reached = 0;    // Cells with a finite distance, the start included
+};
+
+/* --------------------------- PARALLEL BFS CLASS --------------------------- */
+/**
+ * @brief 4-connected BFS whose levels are spread over a thread pool (Beamer's direction optimization)
+ *
+ * Every level runs one of two ways:
+ * - top-down: workers walk slices of the frontier list and claim unvisited neighbours by
+ *   atomically clearing their bit in the unvisited bitmap; the claim decides the single owner.
+ * - bottom-up: workers own blocks of rows and test 64 unvisited cells at a time against the
+ *   frontier bitmap shifted left, right, up and down.
+ * Top-down costs O(frontier), bottom-up O(unvisited / 64), so the search switches to bottom-up
+ * when frontier * alpha > unvisited and back when frontier * beta < free cells.
+ *
+ * The levels are the same as bfs_search, so the distances equal those of the serial BFS.
+ */
+class ParallelBFS
+{
+private:
+    const GridMap *map;
+    ThreadPool pool;
+    std::uint32_t width, height, stride;
+    std::uint32_t words_per_row;                               // Bitmap words per grid row
+    std::unique_ptr<std::atomic<std::uint64_t>[]> unvisited;   // Free cells without a distance yet
+    std::unique_ptr<std::atomic<std::uint64_t>[]> in_frontier; // Cells of the current level
+    std::size_t bitmap_words;
+    std::vector<std::uint32_t> frontier;                       // Cells of the current level
+    std::vector<std::vector<std::uint32_t>> next_frontier;     // Cells found by each worker for the next level
+    std::vector<std::uint64_t> free_per_worker;                // Free cells each worker packed into the bitmap
+    std::uint32_t alpha, beta;                                 // Direction switch factors
+    ParallelBFSStats stats;
+
+    void bind_grid(void);
+    void top_down_level(std::uint32_t *distance, std::uint32_t level);
+    void bottom_up_level(std::uint32_t *distance, std::uint32_t level);
+    void gather_frontier(void);
+
+public:
+    explicit ParallelBFS(const GridMap &map, std::uint32_t thread_count = 0);
+    void set_switch_factors(std::uint32_t alpha, std::uint32_t beta);
+    std::uint64_t distance_field(std::uint32_t start_y, std::uint32_t start_x, std::vector<std::uint32_t> &distance);
+    const ParallelBFSStats &get_stats(void) const { return stats; }
+};
+
+#endif // PLANNER_PARALLEL_BFS_HPP
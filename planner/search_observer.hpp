@@ -0,0 +1,58 @@
+/**
+ * @file search_observer.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Optional hook through which a front-end can watch a search without the planner knowing how it is drawn
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_SEARCH_OBSERVER_HPP
+#define PLANNER_SEARCH_OBSERVER_HPP
+
+#include <cstdint>
+#include <array>
+#include <string>
+
+#include "grid_path.hpp"
+
+/**
+ * @brief Receives search events from StartSearch.
+ *
+ * Every callback has an empty default so an observer only overrides what it needs.
+ * The planner calls nothing when no observer is attached, so headless queries pay no rendering cost.
+ */
+class SearchObserver
+{
+public:
+    virtual ~SearchObserver() = default;
+
+    /**
+     * @brief Called once before the first cell is expanded
+     *
+     * @param search_type Search Tag Type
+     * @param start_pos (y,x) start cell
+     * @param end_pos (y,x) goal cell
+     */
+    virtual void on_search_start(const std::string & /*search_type*/, std::array<std::uint32_t, 2> /*start_pos*/, std::array<std::uint32_t, 2> /*end_pos*/) {}
+
+    /**
+     * @brief Called every time a cell is taken off the frontier and expanded
+     *
+     * @param y
+     * @param x
+     */
+    virtual void on_cell_expanded(std::uint32_t /*y*/, std::uint32_t /*x*/) {}
+
+    /**
+     * @brief Called once after the search ends
+     *
+     * @param path_found True -> path holds the cells from start to goal
+     *                      False -> path is empty
+     * @param path Cells from start to goal
+     */
+    virtual void on_search_complete(bool /*path_found*/, const GridPath & /*path*/) {}
+};
+
+#endif // PLANNER_SEARCH_OBSERVER_HPP
@@ -0,0 +1,258 @@
+/**
+ * @file setup_grid.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Obstacle field generation for the path planners
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "setup_grid.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#define GOLDEN_GAMMA 0x9e3779b97f4a7c15ull // Weyl step of SplitMix64
+
+/**
+ * @brief SplitMix64 finalizer, a bijective 64-bit mixer
+ */
+static std::uint64_t mix64(std::uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                         SETUP_GRID CLASS DEFINITION                        */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Random word number counter of the stream of a tile
+ *
+ * Counter-based: the word depends only on (seed, tile, counter), so tiles draw independently.
+ *
+ * @param tile Row-major tile index
+ * @param counter Draw number within the tile
+ * @return std::uint64_t
+ */
+std::uint64_t Setup_Grid::random_word(std::uint32_t tile, std::uint64_t counter) const
+{
+    std::uint64_t stream = mix64(this->seed + (tile + 1) * GOLDEN_GAMMA);
+    return mix64(stream + (counter + 1) * GOLDEN_GAMMA);
+}
+
+/**
+ * @brief Obstacle cells a tile needs, its share of the map target
+ *
+ * Shares are differences of the rounded-down target over the cells before and after the tile in
+ * row-major tile order, so they add up to the map target exactly.
+ *
+ * @param tile Row-major tile index
+ * @return std::uint64_t
+ */
+std::uint64_t Setup_Grid::tile_target(std::uint32_t tile) const
+{
+    std::uint64_t total_pixels = static_cast<std::uint64_t>(this->grid_width) * this->grid_height;
+    std::uint32_t tile_y = tile / this->tiles_x, tile_x = tile % this->tiles_x;
+    std::uint64_t band_height = std::min<std::uint32_t>(SETUP_GRID_TILE_SIZE, this->grid_height - tile_y * SETUP_GRID_TILE_SIZE);
+    std::uint64_t tile_width = std::min<std::uint32_t>(SETUP_GRID_TILE_SIZE, this->grid_width - tile_x * SETUP_GRID_TILE_SIZE);
+    std::uint64_t cells_before = static_cast<std::uint64_t>(tile_y) * SETUP_GRID_TILE_SIZE * this->grid_width +
+                                 band_height * tile_x * SETUP_GRID_TILE_SIZE;
+    std::uint64_t cells_after = cells_before + band_height * tile_width;
+    auto target = [&](std::uint64_t cells)
+    {
+        // coverage * cells / 100 without overflowing for maps near GRID_MAX_CELLS
+        return (cells / 100) * this->coverage_percentage + (cells % 100) * this->coverage_percentage / 100;
+    };
+    return (total_pixels == 0) ? 0 : target(cells_after) - target(cells_before);
+}
+
+/**
+ * @brief Set the bit on grid array
+ * @param block_type
+ * 0 -> Line
+ * |* 0|
+ * |* 0|
+ * |* 0|
+ * |* 0|
+ * 1 -> Inverted L
+ * |* *|
+ * |0 *|
+ * |0 *|
+ * 2 -> S
+ * |* 0|
+ * |* *|
+ * |0 *|
+ * 3 -> T
+ * |0 *|
+ * |* *|
+ * |0 *|
+ * @param y
+ * @param x Top-left cell of the block
+ * @param y_end Row past the tile the block is placed in
+ * @param x_end Column past the tile
+ * @return std::uint32_t Cells that became obstacles
+ * @throw std::invalid_argument if block_type is not 0 .. 3
+ */
+std::uint32_t Setup_Grid::update_grid_array(uint8_t block_type, std::uint32_t y, std::uint32_t x, std::uint32_t y_end, std::uint32_t x_end)
+{
+    switch (block_type)
+    {
+    case 0: // Line
+        return mark_obstacle(y, x, y_end, x_end) + mark_obstacle(y + 1, x, y_end, x_end) +
+               mark_obstacle(y + 2, x, y_end, x_end) + mark_obstacle(y + 3, x, y_end, x_end);
+
+    case 1: // Inverted L
+        return mark_obstacle(y, x, y_end, x_end) + mark_obstacle(y, x + 1, y_end, x_end) +
+               mark_obstacle(y + 1, x + 1, y_end, x_end) + mark_obstacle(y + 2, x + 1, y_end, x_end);
+
+    case 2: // S
+        return mark_obstacle(y, x, y_end, x_end) + mark_obstacle(y + 1, x, y_end, x_end) +
+               mark_obstacle(y + 1, x + 1, y_end, x_end) + mark_obstacle(y + 2, x + 1, y_end, x_end);
+
+    case 3: // Inverted T
+        return mark_obstacle(y, x + 1, y_end, x_end) + mark_obstacle(y + 1, x, y_end, x_end) +
+               mark_obstacle(y + 1, x + 1, y_end, x_end) + mark_obstacle(y + 2, x + 1, y_end, x_end);
+    default:
+        throw std::invalid_argument("Unknown block type " + std::to_string(block_type));
+    }
+}
+
+/**
+ * @brief Mark one cell of a block as obstacle, cells of blocks hanging over the tile edge are dropped
+ *
+ * @param y
+ * @param x
+ * @param y_end Row past the tile
+ * @param x_end Column past the tile
+ * @return std::uint32_t 1 if the cell was not an obstacle yet
+ */
+std::uint32_t Setup_Grid::mark_obstacle(std::uint32_t y, std::uint32_t x, std::uint32_t y_end, std::uint32_t x_end)
+{
+    if (y >= y_end || x >= x_end)
+        return 0;
+    std::uint8_t &cell = this->map->data()[this->map->index(y, x)];
+    std::uint32_t added = (cell != BLOCK_OBSTACLE);
+    cell = BLOCK_OBSTACLE;
+    return added;
+}
+
+/**
+ * @brief Clear one tile and place random blocks in it until it meets its share of the coverage
+ *
+ * Touches only the cells of the tile, so different tiles may be filled concurrently.
+ *
+ * @param tile Row-major tile index
+ */
+void Setup_Grid::fill_tile(std::uint32_t tile)
+{
+    std::uint32_t y_begin = (tile / this->tiles_x) * SETUP_GRID_TILE_SIZE;
+    std::uint32_t x_begin = (tile % this->tiles_x) * SETUP_GRID_TILE_SIZE;
+    std::uint32_t y_end = std::min<std::uint32_t>(y_begin + SETUP_GRID_TILE_SIZE, this->grid_height);
+    std::uint32_t x_end = std::min<std::uint32_t>(x_begin + SETUP_GRID_TILE_SIZE, this->grid_width);
+    std::uint64_t tile_height = y_end - y_begin, tile_width = x_end - x_begin;
+
+    std::uint64_t covered = 0;
+    for (std::uint32_t y = y_begin; y < y_end; y++)
+    {
+        std::uint8_t *row = this->map->data() + this->map->index(y, x_begin);
+        for (std::uint32_t x = 0; x < tile_width; x++)
+            covered += (row[x] == BLOCK_OBSTACLE);
+    }
+    // Regenerating starts from the same empty tile as the first generation
+    if (covered != 0)
+        for (std::uint32_t y = y_begin; y < y_end; y++)
+            std::fill_n(this->map->data() + this->map->index(y, x_begin), tile_width, BLOCK_EMPTY);
+    covered = 0;
+
+    // Place blocks until the coverage is met: low 2 bits pick the block, the 32-bit halves the position
+    std::uint64_t target = tile_target(tile);
+    for (std::uint64_t draw = 0; covered < target; draw++)
+    {
+        std::uint64_t word = random_word(tile, draw);
+        std::uint32_t y = y_begin + static_cast<std::uint32_t>(((word >> 32) * tile_height) >> 32);
+        std::uint32_t x = x_begin + static_cast<std::uint32_t>(((word & UINT32_MAX) * tile_width) >> 32);
+        covered += update_grid_array(word & 3, y, x, y_end, x_end);
+    }
+    this->tile_covered[tile] = covered;
+}
+
+/**
+ * @brief Construct a new Setup_Grid object
+ *
+ * @param map Map to generate into, must outlive the Setup_Grid
+ * @param grid_width
+ * @param grid_height
+ * @param coverage_percentage range (0,100)
+ * @param seed Equal seeds give bit-identical maps
+ * @param thread_count Threads filling tiles, 0 for one per hardware thread
+ */
+Setup_Grid::Setup_Grid(GridMap &map, std::uint32_t grid_width, std::uint32_t grid_height, std::uint8_t coverage_percentage,
+                       std::uint64_t seed, std::uint32_t thread_count) : pool(thread_count)
+{
+    this->map = &map;
+    this->grid_width = grid_width;
+    this->grid_height = grid_height;
+    this->coverage_percentage = std::min<std::uint8_t>(coverage_percentage, 100);
+    this->seed = seed;
+    this->tiles_x = (grid_width + SETUP_GRID_TILE_SIZE - 1) / SETUP_GRID_TILE_SIZE;
+    this->tiles_y = (grid_height + SETUP_GRID_TILE_SIZE - 1) / SETUP_GRID_TILE_SIZE;
+    this->tile_covered.assign(static_cast<std::size_t>(this->tiles_x) * this->tiles_y, 0);
+}
+
+/**
+ * @brief Resize the map to grid_width x grid_height and fill it with obstacles
+ */
+void Setup_Grid::initialize_grid(void)
+{
+    this->map->resize(this->grid_width, this->grid_height);
+    this->pool.parallel_for(tile_count(), [this](std::uint32_t, std::size_t tile)
+                            { fill_tile(static_cast<std::uint32_t>(tile)); });
+    this->map->mark_modified();
+}
+
+/**
+ * @brief Regenerate one tile of a map built by initialize_grid(), e.g. after editing it
+ *
+ * @param tile_y Tile row, cells tile_y * SETUP_GRID_TILE_SIZE onwards
+ * @param tile_x Tile column
+ */
+void Setup_Grid::generate_tile(std::uint32_t tile_y, std::uint32_t tile_x)
+{
+    if (tile_y >= this->tiles_y || tile_x >= this->tiles_x)
+        return;
+    fill_tile(tile_y * this->tiles_x + tile_x);
+    this->map->mark_modified();
+}
+
+/**
+ * @brief Obstacle cells placed by the generator, counted as they were marked
+ *
+ * @return std::uint64_t
+ */
+std::uint64_t Setup_Grid::get_covered_cells(void) const
+{
+    std::uint64_t covered = 0;
+    for (std::uint64_t cells : this->tile_covered)
+        covered += cells;
+    return covered;
+}
+
+/**
+ * @brief Clear the value of grid cells from BLOCK_VISITED to BLOCK_CLEAR
+ *
+ * Searches keep their visited cells outside the map and never write BLOCK_VISITED, so this is
+ * only needed for maps marked by hand. It is not required between searches.
+ */
+void Setup_Grid::clear_grid(void)
+{
+    std::uint8_t *cells = this->map->data();
+    for (std::uint32_t cell = 0; cell < this->map->cell_count(); cell++)
+        if (cells[cell] == BLOCK_VISITED)
+            cells[cell] = BLOCK_EMPTY;
+    this->map->mark_modified();
+}
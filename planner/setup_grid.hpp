@@ -0,0 +1,62 @@
+/**
+ * @file setup_grid.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Obstacle field generation for the path planners
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_SETUP_GRID_HPP
+#define PLANNER_SETUP_GRID_HPP
+
+#include "common.hpp"
+#include "thread_pool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#define SETUP_GRID_DEFAULT_SEED 0x5eed // Seed of maps generated without an explicit one
+#define SETUP_GRID_TILE_SIZE 256       // Side of the independently generated tiles
+
+/* ---------------------------- GRID SETUP CLASS ---------------------------- */
+/**
+ * @brief Initialize the Grid to setup the Grid to create the map for path planning
+ *
+ * The map is cut into SETUP_GRID_TILE_SIZE square tiles, and each tile is filled with random
+ * blocks until it reaches its share of the coverage. A tile draws its blocks from its own
+ * counter-based random stream (seed, tile, draw number) and drops block cells that hang over its
+ * edge, so tiles are generated in parallel and the map depends on the seed alone, not on the
+ * thread count or the order the tiles finish in. Coverage is counted as cells are marked.
+ * generate_tile() regenerates one tile with the same result.
+ */
+class Setup_Grid
+{
+private:
+    GridMap *map; // Map being generated, owned by the caller
+    std::uint32_t grid_width;
+    std::uint32_t grid_height;
+    std::uint8_t coverage_percentage;
+    std::uint64_t seed;
+    std::uint32_t tiles_x, tiles_y;         // Tiles per row and per column
+    std::vector<std::uint64_t> tile_covered; // Obstacle cells of every tile
+    ThreadPool pool;
+
+    std::uint64_t random_word(std::uint32_t tile, std::uint64_t counter) const;
+    std::uint64_t tile_target(std::uint32_t tile) const;
+    std::uint32_t update_grid_array(uint8_t block_type, std::uint32_t y, std::uint32_t x, std::uint32_t y_end, std::uint32_t x_end);
+    std::uint32_t mark_obstacle(std::uint32_t y, std::uint32_t x, std::uint32_t y_end, std::uint32_t x_end);
+    void fill_tile(std::uint32_t tile);
+
+public:
+    Setup_Grid(GridMap &map, std::uint32_t grid_width, std::uint32_t grid_height, std::uint8_t coverage_percentage,
+               std::uint64_t seed = SETUP_GRID_DEFAULT_SEED, std::uint32_t thread_count = 0);
+    void initialize_grid(void);
+    void generate_tile(std::uint32_t tile_y, std::uint32_t tile_x);
+    void clear_grid(void);
+    std::uint32_t tile_count(void) const { return tiles_x * tiles_y; }
+    std::uint64_t get_covered_cells(void) const;
+};
+
+#endif // PLANNER_SETUP_GRID_HPP
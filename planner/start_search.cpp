@@ -0,0 +1,1063 @@
+/**
+ * @file start_search.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Headless grid path planners: grid in, path and statistics out
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "start_search.hpp"
+#include "component_index.hpp"
+#include "goal_field_cache.hpp"
+#include "landmark_table.hpp"
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+/* -------------------------------------------------------------------------- */
+/*                        STARTSEARCH CLASS DEFINITION                        */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------- AUXILIARY DEFINITION -------------------------- */
+/**
+ * @brief Search for all the locations around the current cell
+ *
+ * @param x
+ * @param y
+ * A cell is empty when it is no obstacle and has not been closed by the running search. The map
+ * itself is never written; visited state lives in the epoch-stamped visit_stamp array.
+ *
+ * @param mark_location True -> Close the cell if empty
+ *                          False -> Don't close the cell if empty or the edge cells are detected which cannot be visited.
+ * @return true
+ * @return false
+ */
+bool StartSearch::is_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (x == this->width - 1)
+        return false;
+
+    if (is_open_cell(cell_index(y, x + 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y, x + 1));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_down_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == this->height - 1)
+        return false;
+    if (is_open_cell(cell_index(y + 1, x)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y + 1, x));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (x == 0)
+        return false;
+    if (is_open_cell(cell_index(y, x - 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y, x - 1));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_up_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == 0)
+        return false;
+    if (is_open_cell(cell_index(y - 1, x)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y - 1, x));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_up_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == 0 or x == 0)
+        return false;
+    if (is_open_cell(cell_index(y - 1, x - 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y - 1, x - 1));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_up_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == 0 or x == this->width - 1)
+        return false;
+    if (is_open_cell(cell_index(y - 1, x + 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y - 1, x + 1));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_down_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == this->height - 1 or x == 0)
+        return false;
+    if (is_open_cell(cell_index(y + 1, x - 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y + 1, x - 1));
+        return true;
+    }
+    return false;
+}
+
+bool StartSearch::is_down_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location)
+{
+    if (y == this->height - 1 or x == this->width - 1)
+        return false;
+    if (is_open_cell(cell_index(y + 1, x + 1)))
+    {
+        if (mark_location)
+            mark_closed(cell_index(y + 1, x + 1));
+        return true;
+    }
+    return false;
+}
+
+/* ------------------------- PATH PLOTTING FUNCTION ------------------------- */
+/**
+ * @brief Rebuild the path by walking the predecessor array back from the goal
+ *
+ * The length is counted first so the cells are written straight into their final slot, start first.
+ *
+ * @param goal Cell index of the goal
+ * @return std::uint32_t Number of cells on the path
+ */
+std::uint32_t StartSearch::extract_path(std::uint32_t goal)
+{
+    PLANNER_STAT(auto extract_begin = std::chrono::steady_clock::now());
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+
+    std::uint32_t length = 1;
+    for (std::uint32_t cell = goal; cell != start; cell = this->parent[cell])
+        length++;
+
+    this->path.cells.resize(length);
+    std::uint32_t cell = goal;
+    for (std::uint32_t pos = length; pos > 0; pos--)
+    {
+        this->path.cells[pos - 1] = cell;
+        cell = this->parent[cell];
+    }
+
+    this->cell_count = length; // Update the list count
+    PLANNER_STAT(this->stats.extract_ns += elapsed_ns(extract_begin));
+    return this->cell_count;
+}
+
+/**
+ * @brief Count the expansion and forward it to the observer, if one is attached
+ *
+ * @param y
+ * @param x
+ */
+void StartSearch::expand_cell(std::uint32_t y, std::uint32_t x)
+{
+    PLANNER_STAT(this->stats.nodes_expanded++);
+    if (this->observer != nullptr)
+        this->observer->on_cell_expanded(y, x);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           PATH PLANNING FUNCTIONS                          */
+/* -------------------------------------------------------------------------- */
+
+/* ------------------------------ RANDOM SEARCH ----------------------------- */
+
+/**
+ * @brief Perform Random Search
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::random_search(void)
+{
+    std::uint32_t candidates[4]; // Empty neighbours of the current cell
+    std::uint8_t candidate_count;
+
+    bool path_found = false; // Boolean to determine whether the path is found or not
+
+    mark_closed(cell_index(start_pos[0], start_pos[1])); // Mark the Start as visited
+
+    std::uint32_t x = start_pos[1];
+    std::uint32_t y = start_pos[0];
+
+    while (true)
+    {
+        expand_cell(y, x); // Mark the Current node as visited
+
+        if ((y == end_pos[0]) && (x == end_pos[1])) // Break if end point reached
+        {
+            path_found = true;
+            break;
+        }
+
+        // Look for surrounding Neighbors, if empty then add them to the candidates and mark them as visited
+        std::uint32_t cell = cell_index(y, x);
+        candidate_count = 0;
+        if (is_up_empty(x, y, true))
+            candidates[candidate_count++] = cell - this->stride;
+        if (is_left_empty(x, y, true))
+            candidates[candidate_count++] = cell - 1;
+        if (is_down_empty(x, y, true))
+            candidates[candidate_count++] = cell + this->stride;
+        if (is_right_empty(x, y, true))
+            candidates[candidate_count++] = cell + 1;
+        PLANNER_STAT(this->stats.nodes_pushed += candidate_count);
+
+        if (candidate_count == 0)
+            break;
+
+        std::uint32_t next = candidates[this->random_engine() % candidate_count];
+        this->parent[next] = cell;
+        y = next / this->stride;
+        x = next % this->stride;
+    }
+
+    std::uint32_t steps = 0;
+    if (path_found)
+        steps = extract_path(cell_index(end_pos[0], end_pos[1])); // Walk the parents back to the start
+    return steps;
+}
+
+/* ------------------------- BREADTH - FIRST SEARCH ------------------------- */
+
+/**
+ * @brief Perform BFS Search
+ *
+ * Every cell is marked visited when it is pushed, so it enters the queue at most once and the
+ * frontier fits in a single ring of one index per cell.
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::bfs_search(void)
+{
+    // FIFO Queue of cell indices, head and tail into the preallocated frontier
+    std::uint32_t *queue = this->frontier.data();
+    std::uint32_t head = 0, tail = 0;
+
+    bool path_found = false; // Boolean to determine whether the path is found or not.
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+
+    // Push the Start to Queue
+    queue[tail++] = cell_index(start_pos[0], start_pos[1]);
+    PLANNER_STAT(this->stats.nodes_pushed++);
+
+    mark_closed(cell_index(start_pos[0], start_pos[1])); // Mark Start as Visited
+
+    while (head != tail) // Continue till the queue is empty or end position is reached
+    {
+        PLANNER_STAT(this->stats.peak_frontier = std::max(this->stats.peak_frontier, tail - head));
+
+        // Pop the First Element from Queue
+        std::uint32_t cell = queue[head++];
+        std::uint32_t y = cell / this->stride;
+        std::uint32_t x = cell % this->stride;
+
+        expand_cell(y, x); // Mark the Current Node as Visited
+
+        if (cell == goal) // Break if End Point Reached
+        {
+            path_found = true;
+            break;
+        }
+
+        // Look for surrounding Neighbors, if empty then add them to queue and mark them as visited
+        if (is_right_empty(x, y, true))
+        {
+            this->parent[cell + 1] = cell;
+            queue[tail++] = cell + 1;
+        }
+        if (is_down_empty(x, y, true))
+        {
+            this->parent[cell + this->stride] = cell;
+            queue[tail++] = cell + this->stride;
+        }
+        if (is_left_empty(x, y, true))
+        {
+            this->parent[cell - 1] = cell;
+            queue[tail++] = cell - 1;
+        }
+        if (is_up_empty(x, y, true))
+        {
+            this->parent[cell - this->stride] = cell;
+            queue[tail++] = cell - this->stride;
+        }
+    }
+    PLANNER_STAT(this->stats.nodes_pushed = tail);
+
+    std::uint32_t steps = 0;
+    if (path_found)
+        steps = extract_path(goal); // Walk the parents back to the start
+    return steps;
+}
+
+/* -------------------------- DEPTH - FIRST SEARCH -------------------------- */
+/**
+ * @brief Perform DFS Search
+ *
+ * Cells are marked visited when pushed, so the stack never holds more than one index per cell.
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::dfs_search(void)
+{
+    // LIFO Stack of cell indices on top of the preallocated frontier
+    std::uint32_t *stack = this->frontier.data();
+    std::uint32_t top = 0;
+
+    bool path_found = false; // Boolean to determine whether the path is found or not
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+
+    // Push the Start Node to Stack
+    stack[top++] = cell_index(start_pos[0], start_pos[1]);
+    PLANNER_STAT(this->stats.nodes_pushed++);
+
+    mark_closed(cell_index(start_pos[0], start_pos[1])); // Mark the Start as visited
+
+    while (top != 0)
+    {
+        PLANNER_STAT(this->stats.peak_frontier = std::max(this->stats.peak_frontier, top));
+
+        // Pop the last element from the Stack
+        std::uint32_t cell = stack[--top];
+        std::uint32_t y = cell / this->stride;
+        std::uint32_t x = cell % this->stride;
+
+        expand_cell(y, x); // Mark the Current node as visited
+
+        if (cell == goal) // Break if end point reached
+        {
+            path_found = true;
+            break;
+        }
+
+        // Look for surrounding Neighbors, if empty then add them to stack and mark them as visited
+        if (is_up_empty(x, y, true))
+        {
+            this->parent[cell - this->stride] = cell;
+            stack[top++] = cell - this->stride;
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+        if (is_left_empty(x, y, true))
+        {
+            this->parent[cell - 1] = cell;
+            stack[top++] = cell - 1;
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+        if (is_down_empty(x, y, true))
+        {
+            this->parent[cell + this->stride] = cell;
+            stack[top++] = cell + this->stride;
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+        if (is_right_empty(x, y, true))
+        {
+            this->parent[cell + 1] = cell;
+            stack[top++] = cell + 1;
+            PLANNER_STAT(this->stats.nodes_pushed++);
+        }
+    }
+
+    std::uint32_t steps = 0;
+    if (path_found)
+        steps = extract_path(goal); // Walk the parents back to the start
+    return steps;
+}
+
+/* ----------------------------- DIJKSTRA SEARCH ---------------------------- */
+/**
+ * @brief Lower the distance of a neighbour if the path through cell is shorter, and queue it
+ *
+ * @param cell Cell being expanded
+ * @param neighbour Empty neighbour of cell
+ * @param distance Distance of neighbour through cell
+ */
+inline void StartSearch::relax_neighbour(std::uint32_t cell, std::uint32_t neighbour, double distance)
+{
+    if (is_reached(neighbour) && distance >= this->distance_list[neighbour])
+        return;
+
+    this->distance_list[neighbour] = distance;
+    mark_reached(neighbour);
+    this->parent[neighbour] = cell;
+    if (this->open_list.contains(neighbour))
+    {
+        this->open_list.decrease_key(neighbour, distance);
+        PLANNER_STAT(this->stats.decrease_keys++);
+    }
+    else
+    {
+        this->open_list.push(neighbour, distance);
+        PLANNER_STAT(this->stats.nodes_pushed++);
+    }
+}
+
+/**
+ * @brief Perform Dijkstra Search
+ *
+ * Label-setting Dijkstra on the 8-connected grid. Cells are kept once in an indexed heap and
+ * lowered with decrease-key, so every cell is settled (expanded) at most once with its final
+ * distance. Straight and diagonal moves are priced by move_costs.
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::dijkstra_search(void)
+{
+    bool path_found = false; // Boolean to determine whether the path is found or not
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+    double straight = this->move_costs.straight;
+    double diagonal = this->move_costs.diagonal;
+
+    this->open_list.clear();
+
+    // Push the Start Node into the queue, its own parent at distance 'zero'
+    this->distance_list[start] = 0;
+    this->parent[start] = start;
+    mark_reached(start);
+    this->open_list.push(start, 0);
+    PLANNER_STAT(this->stats.nodes_pushed++);
+
+    while (!this->open_list.empty())
+    {
+        // Pop the closest node, its distance is final
+        std::uint32_t cell = this->open_list.pop();
+        std::uint32_t y = cell / this->stride;
+        std::uint32_t x = cell % this->stride;
+        double distance = this->distance_list[cell];
+
+        mark_closed(cell_index(y, x)); // Mark the Node as settled
+        PLANNER_STAT(this->stats.nodes_settled++);
+        expand_cell(y, x);
+
+        if (cell == goal) // Break if end point is reached
+        {
+            path_found = true;
+            break;
+        }
+
+        // Relax the surrounding empty cells, settled cells are closed and skipped
+        if (is_down_empty(x, y, false))
+            relax_neighbour(cell, cell + this->stride, distance + straight);
+        if (is_down_left_empty(x, y, false))
+            relax_neighbour(cell, cell + this->stride - 1, distance + diagonal);
+        if (is_left_empty(x, y, false))
+            relax_neighbour(cell, cell - 1, distance + straight);
+        if (is_up_left_empty(x, y, false))
+            relax_neighbour(cell, cell - this->stride - 1, distance + diagonal);
+        if (is_up_empty(x, y, false))
+            relax_neighbour(cell, cell - this->stride, distance + straight);
+        if (is_up_right_empty(x, y, false))
+            relax_neighbour(cell, cell - this->stride + 1, distance + diagonal);
+        if (is_right_empty(x, y, false))
+            relax_neighbour(cell, cell + 1, distance + straight);
+        if (is_down_right_empty(x, y, false))
+            relax_neighbour(cell, cell + this->stride + 1, distance + diagonal);
+    }
+    PLANNER_STAT(this->stats.peak_frontier = this->open_list.peak_size());
+
+    std::uint32_t steps = 0;
+    if (path_found)
+    {
+        this->stats.path_cost = this->distance_list[goal];
+        steps = extract_path(goal); // Walk the parents back to the start
+    }
+    return steps;
+}
+
+/* -------------------------------- A* SEARCH ------------------------------- */
+/**
+ * @brief Lower bound of the remaining cost from cell to the goal
+ *
+ * @param cell Cell index
+ * @return double Heuristic selected for the running search
+ */
+double StartSearch::heuristic(std::uint32_t cell)
+{
+    std::uint32_t dy = std::abs(static_cast<std::int64_t>(cell / this->stride) - static_cast<std::int64_t>(end_pos[0]));
+    std::uint32_t dx = std::abs(static_cast<std::int64_t>(cell % this->stride) - static_cast<std::int64_t>(end_pos[1]));
+
+    switch (this->active_heuristic)
+    {
+    case HEURISTIC_MANHATTAN:
+        return this->move_costs.straight * (dx + dy);
+    case HEURISTIC_OCTILE:
+        return octile_bound(dx, dy);
+    case HEURISTIC_LANDMARKS:
+    {
+        // The max of two consistent bounds is consistent
+        double geometric = (this->astar_config.connectivity == 8) ? octile_bound(dx, dy) : this->move_costs.straight * (dx + dy);
+        return std::max(geometric, this->landmarks->lower_bound(cell, cell_index(end_pos[0], end_pos[1])));
+    }
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Cheapest cost of a dy x dx offset on an empty 8-connected grid, for any positive move costs
+ *
+ * Octile distance while straight <= diagonal <= 2 * straight. A dearer diagonal never beats two
+ * straight moves, so the bound falls back to Manhattan (as DStarLite::heuristic clamps it); a
+ * cheaper one can zigzag along a row, so every move only counts as one diagonal.
+ */
+double StartSearch::octile_bound(std::uint32_t dx, std::uint32_t dy) const
+{
+    double straight = this->move_costs.straight, diagonal = this->move_costs.diagonal;
+    if (diagonal >= 2 * straight)
+        return straight * (dx + dy);
+    if (diagonal < straight)
+        return diagonal * std::max(dx, dy);
+    return straight * (dx + dy) + (diagonal - 2 * straight) * std::min(dx, dy);
+}
+
+/**
+ * @brief Lower g of a neighbour if the path through cell is shorter, and queue it by f
+ *
+ * @param cell Cell being expanded
+ * @param neighbour Empty neighbour of cell
+ * @param distance g of neighbour through cell
+ */
+void StartSearch::relax_astar_neighbour(std::uint32_t cell, std::uint32_t neighbour, double distance)
+{
+    if (is_reached(neighbour) && distance >= this->distance_list[neighbour])
+        return;
+
+    this->distance_list[neighbour] = distance;
+    mark_reached(neighbour);
+    this->parent[neighbour] = cell;
+
+    AStarKey key;
+    key.f = distance + heuristic(neighbour);
+    key.tie = 0;
+    if (this->astar_config.tie_break == TIE_BREAK_LARGER_G)
+        key.tie = -distance;
+    else if (this->astar_config.tie_break == TIE_BREAK_SMALLER_G)
+        key.tie = distance;
+
+    if (this->astar_open_list.contains(neighbour))
+    {
+        this->astar_open_list.decrease_key(neighbour, key);
+        PLANNER_STAT(this->stats.decrease_keys++);
+    }
+    else
+    {
+        this->astar_open_list.push(neighbour, key);
+        PLANNER_STAT(this->stats.nodes_pushed++);
+    }
+}
+
+/**
+ * @brief Perform A* Search
+ *
+ * Dijkstra ordered by f = g + h. Both heuristics are consistent for the connectivity they are
+ * meant for, so a cell is settled once when popped, exactly like dijkstra_search.
+ *
+ * @return std::uint32_t Number of Steps
+ */
+std::uint32_t StartSearch::astar_search(void)
+{
+    bool path_found = false; // Boolean to determine whether the path is found or not
+    std::uint32_t start = cell_index(start_pos[0], start_pos[1]);
+    std::uint32_t goal = cell_index(end_pos[0], end_pos[1]);
+    double straight = this->move_costs.straight;
+    double diagonal = this->move_costs.diagonal;
+    bool use_diagonals = this->astar_config.connectivity == 8;
+    this->active_heuristic = this->astar_config.heuristic;
+    if (this->active_heuristic == HEURISTIC_LANDMARKS && !can_use_landmarks())
+        this->active_heuristic = use_diagonals ? HEURISTIC_OCTILE : HEURISTIC_MANHATTAN;
+
+    this->astar_open_list.clear();
+
+    // Push the Start Node into the queue, its own parent at distance 'zero'
+    this->distance_list[start] = 0;
+    this->parent[start] = start;
+    mark_reached(start);
+    this->astar_open_list.push(start, AStarKey{heuristic(start), 0});
+    PLANNER_STAT(this->stats.nodes_pushed++);
+
+    while (!this->astar_open_list.empty())
+    {
+        // Pop the node with the lowest f, its g is final
+        std::uint32_t cell = this->astar_open_list.pop();
+        std::uint32_t y = cell / this->stride;
+        std::uint32_t x = cell % this->stride;
+        double distance = this->distance_list[cell];
+
+        mark_closed(cell_index(y, x)); // Mark the Node as settled
+        PLANNER_STAT(this->stats.nodes_settled++);
+        expand_cell(y, x);
+
+        if (cell == goal) // Break if end point is reached
+        {
+            path_found = true;
+            break;
+        }
+
+        // Relax the surrounding empty cells, settled cells are closed and skipped
+        if (is_down_empty(x, y, false))
+            relax_astar_neighbour(cell, cell + this->stride, distance + straight);
+        if (is_left_empty(x, y, false))
+            relax_astar_neighbour(cell, cell - 1, distance + straight);
+        if (is_up_empty(x, y, false))
+            relax_astar_neighbour(cell, cell - this->stride, distance + straight);
+        if (is_right_empty(x, y, false))
+            relax_astar_neighbour(cell, cell + 1, distance + straight);
+        if (!use_diagonals)
+            continue;
+        if (is_down_left_empty(x, y, false))
+            relax_astar_neighbour(cell, cell + this->stride - 1, distance + diagonal);
+        if (is_up_left_empty(x, y, false))
+            relax_astar_neighbour(cell, cell - this->stride - 1, distance + diagonal);
+        if (is_up_right_empty(x, y, false))
+            relax_astar_neighbour(cell, cell - this->stride + 1, distance + diagonal);
+        if (is_down_right_empty(x, y, false))
+            relax_astar_neighbour(cell, cell + this->stride + 1, distance + diagonal);
+    }
+    PLANNER_STAT(this->stats.peak_frontier = this->astar_open_list.peak_size());
+
+    std::uint32_t steps = 0;
+    if (path_found)
+    {
+        this->stats.path_cost = this->distance_list[goal];
+        steps = extract_path(goal); // Walk the parents back to the start
+    }
+    return steps;
+}
+
+/* ------------------------------- CONSTRUCTOR ------------------------------ */
+/**
+ * @brief Construct a search context on map, with the start and end at the first cell
+ *
+ * @param map Map to search, must outlive the context; it is only read
+ */
+StartSearch::StartSearch(const GridMap &map)
+{
+    this->map = &map;
+    this->observer = nullptr;
+    this->cell_count = 0;
+    this->width = 0;
+    this->height = 0;
+    this->stride = 0;
+    this->cell_total = 0;
+    this->active_heuristic = HEURISTIC_OCTILE;
+    this->use_jump_table = false;
+    this->jump_table_version = 0;
+    this->bound_version = 0;
+    this->epoch = 0;
+    this->start_pos = {0, 0};
+    this->end_pos = {0, 0};
+    this->components_4 = nullptr;
+    this->components_8 = nullptr;
+    this->goal_fields = nullptr;
+    this->landmarks = nullptr;
+    this->latency_histogram = nullptr;
+    this->random_engine.seed(std::random_device{}());
+    bind_grid();
+}
+
+/**
+ * @brief Construct a search context on map for one start and end position
+ *
+ * @param map Map to search, must outlive the context; it is only read
+ * @param start_position_y 1-based
+ * @param start_position_x 1-based
+ * @param end_position_y 1-based
+ * @param end_position_x 1-based
+ * @throw std::out_of_range if the start or end position lies outside the grid
+ */
+StartSearch::StartSearch(const GridMap &map, std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x) : StartSearch(map)
+{
+    set_endpoints(start_position_y, start_position_x, end_position_y, end_position_x);
+}
+
+/**
+ * @brief Set the start and end position of the next searches
+ *
+ * The map is not touched: an end position on an obstacle makes the search fail, so callers
+ * that want the endpoints free clear them in their own map.
+ *
+ * @param start_position_y 1-based
+ * @param start_position_x 1-based
+ * @param end_position_y 1-based
+ * @param end_position_x 1-based
+ * @throw std::out_of_range if the start or end position lies outside the grid
+ */
+void StartSearch::set_endpoints(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x)
+{
+    if (!this->map->in_bounds(static_cast<std::int64_t>(start_position_y) - 1, static_cast<std::int64_t>(start_position_x) - 1) ||
+        !this->map->in_bounds(static_cast<std::int64_t>(end_position_y) - 1, static_cast<std::int64_t>(end_position_x) - 1))
+        throw std::out_of_range("Start or end position outside the grid");
+
+    this->start_pos[0] = start_position_y - 1;
+    this->start_pos[1] = start_position_x - 1;
+    this->end_pos[0] = end_position_y - 1;
+    this->end_pos[1] = end_position_x - 1;
+}
+
+/**
+ * @brief Read the dimensions of the map and size the per-cell buffers for it
+ *
+ * The buffers only grow, so back-to-back searches on the same map never reallocate.
+ * The JPS+ jump table is dropped when the grid dimensions change.
+ */
+void StartSearch::bind_grid(void)
+{
+    if (this->map->get_width() != this->width || this->map->get_height() != this->height || this->map->get_stride() != this->stride)
+        this->jump_table.clear();
+
+    this->cells = this->map->data();
+    this->bound_version = this->map->get_version();
+    this->width = this->map->get_width();
+    this->height = this->map->get_height();
+    this->stride = this->map->get_stride();
+    this->path.stride = this->stride;
+    this->cell_total = this->map->cell_count();
+
+    if (this->parent.size() < this->cell_total)
+    {
+        this->parent.resize(this->cell_total);
+        this->frontier.resize(this->cell_total);
+        this->distance_list.resize(this->cell_total);
+        this->visit_stamp.resize(this->cell_total, 0); // Older than any epoch
+    }
+    this->open_list.reserve(this->cell_total);
+    this->astar_open_list.reserve(this->cell_total);
+}
+
+/**
+ * @brief Start a new search epoch, which forgets every reached and closed cell in O(1)
+ *
+ * Each search owns two stamps: epoch (reached, its distance_list entry is valid) and epoch + 1
+ * (closed). Stamps of earlier searches are all smaller, so nothing has to be reset. The stamps
+ * are cleared only when the counter wraps, once every two billion searches.
+ */
+void StartSearch::begin_epoch(void)
+{
+    if (this->epoch >= UINT32_MAX - 2)
+    {
+        std::fill(this->visit_stamp.begin(), this->visit_stamp.end(), 0);
+        std::fill(this->visit_stamp_backward.begin(), this->visit_stamp_backward.end(), 0);
+        this->epoch = 0;
+    }
+    this->epoch += 2;
+}
+
+/**
+ * @brief Check whether the running search moves only up, down, left and right
+ */
+bool StartSearch::is_four_connected(void) const
+{
+    return this->search_type == RANDOM_SEARCH || this->search_type == BFS_SEARCH || this->search_type == DFS_SEARCH ||
+           this->search_type == BIDIRECTIONAL_BFS_SEARCH || (this->search_type == ASTAR_SEARCH && this->astar_config.connectivity == 4);
+}
+
+/**
+ * @brief Look the endpoints up in the component index matching the moves of the running search
+ *
+ * A 4-connected search may fall back on the 8-connected labels, which only ever join more cells:
+ * different 8-connected components are unreachable under either connectivity.
+ *
+ * @return true if the goal is known to be unreachable from the start
+ */
+bool StartSearch::is_unreachable(void)
+{
+    const ComponentIndex *index = nullptr;
+    if (is_four_connected() && this->components_4 != nullptr && this->components_4->is_current(*this->map))
+        index = this->components_4;
+    else if (this->components_8 != nullptr && this->components_8->is_current(*this->map))
+        index = this->components_8;
+    if (index == nullptr)
+        return false;
+
+    // Blocked endpoints are left to the searches, which treat them as they always have
+    this->stats.start_component_size = index->component_size(this->start_pos[0], this->start_pos[1]);
+    this->stats.goal_component_size = index->component_size(this->end_pos[0], this->end_pos[1]);
+    if (this->stats.start_component_size == 0 || this->stats.goal_component_size == 0)
+        return false;
+    return !index->connected(this->start_pos[0], this->start_pos[1], this->end_pos[0], this->end_pos[1]);
+}
+
+/**
+ * @brief Check whether the running search can be answered from a goal field
+ *
+ * Only BFS and Dijkstra, whose fields the cache holds, and only between free cells: a field
+ * floods out of a free goal and never reaches a blocked start.
+ */
+bool StartSearch::can_use_goal_field(void) const
+{
+    if (this->goal_fields == nullptr || (this->search_type != BFS_SEARCH && this->search_type != DIJKSTRA_SEARCH))
+        return false;
+    return this->cells[cell_index(this->start_pos[0], this->start_pos[1])] != BLOCK_OBSTACLE &&
+           this->cells[cell_index(this->end_pos[0], this->end_pos[1])] != BLOCK_OBSTACLE;
+}
+
+/**
+ * @brief Answer the running search by following the cached field of its goal
+ *
+ * The path has the length (and for Dijkstra the cost) the search would find. No cell is expanded;
+ * a cache miss floods the field once for every later query to the goal.
+ *
+ * @return std::uint32_t Number of Steps, 0 if the goal cannot be reached
+ */
+std::uint32_t StartSearch::goal_field_search(void)
+{
+    std::size_t field_bytes = 0;
+    std::shared_ptr<const GoalField> field = this->goal_fields->field(this->end_pos[0], this->end_pos[1], this->search_type, this->move_costs, &field_bytes);
+    PLANNER_STAT(this->stats.bytes_allocated += field_bytes);
+    PLANNER_STAT(auto extract_begin = std::chrono::steady_clock::now());
+    std::uint32_t steps = field->walk(this->start_pos[0], this->start_pos[1], this->path);
+    PLANNER_STAT(this->stats.extract_ns = elapsed_ns(extract_begin));
+    if (steps != 0)
+    {
+        if (this->search_type == DIJKSTRA_SEARCH)
+            this->stats.path_cost = field->distance[cell_index(this->start_pos[0], this->start_pos[1])];
+    }
+    this->cell_count = steps;
+    return steps;
+}
+
+/**
+ * @brief Check whether the attached landmark table bounds the running A* search
+ *
+ * The table must be current and priced like the search. An 8-connected table also bounds a
+ * 4-connected search, whose distances are never shorter; a 4-connected one only bounds its own.
+ */
+bool StartSearch::can_use_landmarks(void) const
+{
+    if (this->landmarks == nullptr || !this->landmarks->is_current(*this->map))
+        return false;
+    const MoveCosts &table_costs = this->landmarks->get_move_costs();
+    if (table_costs.straight != this->move_costs.straight || table_costs.diagonal != this->move_costs.diagonal)
+        return false;
+    return this->landmarks->get_connectivity() == 8 || this->astar_config.connectivity == 4;
+}
+
+/* ----------------------------- SEARCH FUNCTION ---------------------------- */
+/**
+ * @brief Search the Grid as requested
+ *
+ * @param search_type Search Tag Type
+ * @param observer Optional listener for search events (visualization, logging), nullptr for a headless search
+ * @return std::uint32_t Number of Steps, 0 if the search failed
+ * @throw std::out_of_range if the map shrank and no longer holds the start or end position
+ */
+std::uint32_t StartSearch::initiate_search(const std::string &search_type, SearchObserver *observer)
+{
+    PLANNER_STAT(auto search_begin = std::chrono::steady_clock::now());
+    PLANNER_STAT(std::size_t bytes_before = workspace_bytes());
+    this->path.clear();
+    this->cell_count = 0;
+    this->stats = SearchStats();
+    this->observer = observer;
+    this->search_type = search_type;
+    bind_grid();
+    if (!this->map->in_bounds(this->start_pos[0], this->start_pos[1]) || !this->map->in_bounds(this->end_pos[0], this->end_pos[1]))
+        throw std::out_of_range("Start or end position outside the grid");
+    begin_epoch();
+
+    if (this->observer != nullptr)
+        this->observer->on_search_start(this->search_type, this->start_pos, this->end_pos);
+
+    std::uint32_t steps = 0;
+    bool unreachable = is_unreachable();
+    PLANNER_STAT(auto dispatch_begin = std::chrono::steady_clock::now());
+    PLANNER_STAT(this->stats.setup_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dispatch_begin - search_begin).count());
+    if (unreachable)
+        steps = 0; // Endpoints in different components, fail without searching or printing
+    else if (can_use_goal_field())
+        steps = goal_field_search();
+    else if (search_type == RANDOM_SEARCH)
+        steps = random_search();
+    else if (search_type == BFS_SEARCH)
+        steps = bfs_search();
+    else if (search_type == DFS_SEARCH)
+        steps = dfs_search();
+    else if (search_type == DIJKSTRA_SEARCH)
+        steps = dijkstra_search();
+    else if (search_type == ASTAR_SEARCH)
+        steps = astar_search();
+    else if ((search_type == JPS_SEARCH || search_type == JPS_PLUS_SEARCH) && !jump_costs_supported())
+        steps = dijkstra_search(); // Jump pruning would miss cheaper paths, A* with a zero heuristic instead
+    else if (search_type == JPS_SEARCH)
+        steps = jps_search(false);
+    else if (search_type == JPS_PLUS_SEARCH)
+        steps = jps_search(true);
+    else if (search_type == BIDIRECTIONAL_BFS_SEARCH)
+        steps = bidirectional_bfs_search();
+    else if (search_type == BIDIRECTIONAL_DIJKSTRA_SEARCH)
+        steps = bidirectional_dijkstra_search();
+    this->stats.path_length = steps;
+    PLANNER_STAT(this->stats.search_ns = elapsed_ns(dispatch_begin) - this->stats.extract_ns);
+    PLANNER_STAT(this->stats.bytes_allocated += workspace_bytes() - std::min(workspace_bytes(), bytes_before));
+
+    if (this->observer != nullptr)
+        this->observer->on_search_complete(steps != 0, this->path);
+    this->observer = nullptr;
+    PLANNER_STAT(if (this->latency_histogram != nullptr) this->latency_histogram->record(elapsed_ns(search_begin)));
+    return steps;
+}
+
+/**
+ * @brief Set the price of straight and diagonal moves used by the weighted searches
+ *
+ * Any positive prices keep the paths at the DIJKSTRA_SEARCH cost: the A* heuristics clamp to a
+ * lower bound for them, and JPS / JPS+ run as Dijkstra unless straight <= diagonal <= 2 * straight.
+ *
+ * @param move_costs Positive straight and diagonal move costs
+ * @throw std::invalid_argument if a cost is not positive
+ */
+void StartSearch::set_move_costs(MoveCosts move_costs)
+{
+    if (!(move_costs.straight > 0) || !(move_costs.diagonal > 0))
+        throw std::invalid_argument("Move costs must be positive");
+    this->move_costs = move_costs;
+}
+
+/**
+ * @brief Check whether jump point pruning is exact for the move costs
+ *
+ * JPS assumes the octile metric: a diagonal is no cheaper than a straight move (or zigzags would
+ * beat straight runs) and no dearer than two (or straight detours would beat diagonal runs).
+ */
+bool StartSearch::jump_costs_supported(void) const
+{
+    return this->move_costs.straight <= this->move_costs.diagonal && this->move_costs.diagonal <= 2 * this->move_costs.straight;
+}
+
+/**
+ * @brief Set the heuristic, connectivity and tie-break policy of A*
+ *
+ * @param astar_config Use HEURISTIC_MANHATTAN with connectivity 4 and HEURISTIC_OCTILE with connectivity 8,
+ *                     or HEURISTIC_LANDMARKS with a LandmarkTable attached
+ */
+void StartSearch::set_astar_config(AStarConfig astar_config)
+{
+    this->astar_config = astar_config;
+}
+
+/**
+ * @brief Attach component labels of the map so unreachable queries fail without searching
+ *
+ * The index replaces the attached one of the same connectivity. It is skipped while it is not
+ * current for the map, so edits made without it only cost the early rejection.
+ *
+ * @param component_index Labels built for the searched map, must outlive the context
+ */
+void StartSearch::set_component_index(const ComponentIndex *component_index)
+{
+    if (component_index->get_connectivity() == 4)
+        this->components_4 = component_index;
+    else
+        this->components_8 = component_index;
+}
+
+/**
+ * @brief Detach every component index; all queries are searched again
+ */
+void StartSearch::clear_component_indexes(void)
+{
+    this->components_4 = nullptr;
+    this->components_8 = nullptr;
+}
+
+/**
+ * @brief Attach a cache of goal fields; BFS and Dijkstra queries are then answered from it
+ *
+ * @param goal_field_cache Cache of the searched map, must outlive the context; nullptr detaches it
+ * @throw std::invalid_argument if the cache belongs to another map
+ */
+void StartSearch::set_goal_field_cache(GoalFieldCache *goal_field_cache)
+{
+    if (goal_field_cache != nullptr && &goal_field_cache->get_map() != this->map)
+        throw std::invalid_argument("Goal field cache of another map");
+    this->goal_fields = goal_field_cache;
+}
+
+/**
+ * @brief Attach landmark distances for A* with HEURISTIC_LANDMARKS
+ *
+ * A* falls back on Manhattan / octile while the table is not current for the map or was built for
+ * other move costs.
+ *
+ * @param landmark_table Table built for the searched map, must outlive the context; nullptr detaches it
+ */
+void StartSearch::set_landmark_table(const LandmarkTable *landmark_table)
+{
+    this->landmarks = landmark_table;
+}
+
+/**
+ * @brief Record the time of every search, observer callbacks included, in a histogram
+ *
+ * Several contexts (e.g. the workers of a BatchSearch) may share one histogram. Nothing is recorded
+ * when the library is built with PLANNER_NO_STATS.
+ *
+ * @param latency_histogram Histogram that must outlive the context; nullptr detaches it
+ */
+void StartSearch::set_latency_histogram(LatencyHistogram *latency_histogram)
+{
+    this->latency_histogram = latency_histogram;
+}
+
+/**
+ * @brief Heap bytes held by the search buffers of the context
+ *
+ * @return std::size_t
+ */
+std::size_t StartSearch::workspace_bytes(void) const
+{
+    return (this->parent.capacity() + this->frontier.capacity() + this->visit_stamp.capacity() + this->parent_backward.capacity() +
+            this->frontier_backward.capacity() + this->visit_stamp_backward.capacity() + this->path.cells.capacity()) * sizeof(std::uint32_t) +
+           (this->distance_list.capacity() + this->distance_backward.capacity()) * sizeof(double) +
+           this->jump_table.capacity() * sizeof(std::int32_t) +
+           this->open_list.bytes() + this->astar_open_list.bytes() + this->open_list_backward.bytes();
+}
+
+/**
+ * @brief Cells of the last path found, from start to goal
+ *
+ * @return const GridPath& Packed cells, valid until the next search
+ */
+const GridPath &StartSearch::get_path(void) const
+{
+    return this->path;
+}
+
+/**
+ * @brief Statistics of the last search
+ *
+ * @return const SearchStats&
+ */
+const SearchStats &StartSearch::get_stats(void) const
+{
+    return this->stats;
+}
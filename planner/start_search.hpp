@@ -0,0 +1,223 @@
+/**
+ * @file start_search.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Headless grid path planners: grid in, path and statistics out
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_START_SEARCH_HPP
+#define PLANNER_START_SEARCH_HPP
+
+#include "common.hpp"
+#include "grid_path.hpp"
+#include "indexed_heap.hpp"
+#include "search_observer.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+class ComponentIndex;
+class GoalFieldCache;
+class LandmarkTable;
+class LatencyHistogram;
+
+/**
+ * @brief Cost of the last search
+ */
+struct SearchStats
+{
+    std::uint64_t nodes_expanded = 0; // Cells taken off the frontier and expanded
+    std::uint64_t nodes_pushed = 0;   // Cells pushed onto the frontier
+    std::uint64_t nodes_settled = 0;  // Cells whose distance became final (label-setting searches)
+    std::uint64_t decrease_keys = 0;  // Queued cells whose distance was lowered in place
+    std::uint64_t stale_pops = 0;     // Queue entries taken off only to be skipped or re-queued (0 with decrease-key)
+    std::uint64_t cells_scanned = 0;  // Cells stepped over or looked up while jumping (JPS, JPS+)
+    std::uint32_t peak_frontier = 0;  // Most cells queued at once
+    std::uint32_t path_length = 0;    // Cells on the returned path, 0 if the search failed
+    double path_cost = 0;             // Summed move costs of the returned path (weighted searches)
+    std::uint32_t start_component_size = 0; // Free cells connected to the start, 0 without a current component index
+    std::uint32_t goal_component_size = 0;  // Free cells connected to the goal, 0 without a current component index
+    std::uint64_t setup_ns = 0;       // Binding the map, starting the epoch, reachability checks
+    std::uint64_t search_ns = 0;      // The search itself, path extraction excluded
+    std::uint64_t extract_ns = 0;     // Walking the predecessors into the path
+    std::uint64_t bytes_allocated = 0; // Heap bytes the search buffers and path grew by plus any goal field computed on a cache miss
+};
+
+/**
+ * @brief Price of a single move on the 8-connected grid
+ */
+struct MoveCosts
+{
+    double straight = 1.0;      // Up, down, left, right
+    double diagonal = M_SQRT2;  // Octile distance of one diagonal step
+};
+
+/**
+ * @brief Admissible heuristics for A*, pick the one matching the connectivity
+ */
+enum Heuristic
+{
+    HEURISTIC_ZERO,      // No guidance, A* degenerates to Dijkstra
+    HEURISTIC_MANHATTAN, // Exact on an empty 4-connected grid
+    HEURISTIC_OCTILE,    // Exact on an empty 8-connected grid
+    HEURISTIC_LANDMARKS  // ALT bound of the attached LandmarkTable, never below Manhattan / octile
+};
+
+/**
+ * @brief Order of open cells that share the same f = g + h
+ */
+enum TieBreak
+{
+    TIE_BREAK_NONE,      // Heap order
+    TIE_BREAK_LARGER_G,  // Prefer the cell closer to the goal, stops flooding open areas
+    TIE_BREAK_SMALLER_G  // Prefer the cell closer to the start
+};
+
+/**
+ * @brief A* configuration
+ */
+struct AStarConfig
+{
+    std::uint8_t connectivity = 8;          // 4 -> straight moves only, 8 -> straight and diagonal moves
+    Heuristic heuristic = HEURISTIC_OCTILE; // Must be admissible for the connectivity
+    TieBreak tie_break = TIE_BREAK_LARGER_G;
+};
+
+/**
+ * @brief Priority of an A* open cell: f first, then the tie-break term
+ */
+struct AStarKey
+{
+    double f;   // g + h
+    double tie; // -g, g or 0 depending on the tie-break policy
+
+    bool operator<(const AStarKey &other) const
+    {
+        return (f < other.f) || (f == other.f && tie < other.tie);
+    }
+};
+
+/* ------------------------- SEARCH ALGORITHM CLASS ------------------------- */
+/**
+ * @brief Choose Path Planning algorithm for Grid Path Planning
+ *
+ * A StartSearch is the search context of one thread: it reads the map through a const reference
+ * and keeps every mutable buffer (frontiers, distances, visit stamps, JPS+ table) to itself.
+ * Any number of contexts may search the same map at once, as long as nobody edits the map
+ * while they run.
+ *
+ * With a ComponentIndex attached, a query whose start and goal lie in different components is
+ * rejected before any cell is expanded. An index is only consulted while it is current for the map.
+ * With a GoalFieldCache attached, BFS and Dijkstra queries follow the cached field of their goal.
+ * With a LandmarkTable attached, A* may use the ALT bound as its heuristic.
+ * With a LatencyHistogram attached, the time of every search is recorded in it.
+ */
+class StartSearch
+{
+private:
+    const GridMap *map;                                   // Map being searched, owned by the caller
+    std::string search_type;                              // Tag to determine search type
+    SearchObserver *observer;                             // Optional listener for search events, nullptr when headless
+    GridPath path;                                        // Cells to travel, packed, start first
+    std::array<std::uint32_t, 2> start_pos, end_pos;       // Vector to store starting and end position
+    std::uint32_t cell_count;                             // Step count
+    const std::uint8_t *cells;                            // Cells of the grid being searched, never written by a search
+    std::uint32_t width, height, stride;                  // Dimensions of the grid being searched
+    std::uint32_t cell_total;                             // Number of addressable cells, height * stride
+    std::vector<std::uint32_t> parent;                    // Predecessor cell index of every reached cell
+    std::vector<std::uint32_t> frontier;                  // Packed queue / stack of cell indices for BFS and DFS
+    std::vector<double> distance_list;                    // Distance from start of every reached cell
+    std::vector<std::uint32_t> visit_stamp;               // Epoch a cell was last reached (epoch) or closed (epoch + 1) in
+    std::uint32_t epoch;                                  // Reached stamp of the running search, advanced by 2 per search
+    IndexedHeap<double> open_list;                        // Open cells keyed by distance for Dijkstra
+    IndexedHeap<AStarKey> astar_open_list;                // Open cells keyed by f and tie-break for A*
+    std::vector<std::uint32_t> parent_backward;           // Successor towards the goal, backward half of the bidirectional searches
+    std::vector<std::uint32_t> frontier_backward;         // Backward BFS queue
+    std::vector<double> distance_backward;                // Distance to the goal of every cell reached backwards
+    std::vector<std::uint32_t> visit_stamp_backward;      // Backward reached / closed stamps, same epochs as visit_stamp
+    IndexedHeap<double> open_list_backward;               // Backward open cells of the bidirectional Dijkstra
+    MoveCosts move_costs;                                 // Price of straight and diagonal moves
+    AStarConfig astar_config;                             // Heuristic, connectivity and tie-break of A*
+    Heuristic active_heuristic;                           // Heuristic of the running search
+    std::vector<std::int32_t> jump_table;                 // JPS+ jump distances, 4 cardinal directions per cell
+    std::uint64_t jump_table_version;                     // Map version the jump table was built for
+    std::uint64_t bound_version;                          // Map version of the cells bound by the last bind_grid()
+    bool use_jump_table;                                  // True while a JPS+ search runs
+    SearchStats stats;                                    // Statistics of the last search
+    std::minstd_rand random_engine;                       // Neighbour picks of the random search, private to the context
+    const ComponentIndex *components_4, *components_8;    // Optional labels of the map for straight / all moves, owned by the caller
+    GoalFieldCache *goal_fields;                          // Optional cache answering BFS and Dijkstra from goal fields, owned by the caller
+    const LandmarkTable *landmarks;                       // Optional landmark distances for HEURISTIC_LANDMARKS, owned by the caller
+    LatencyHistogram *latency_histogram;                  // Optional histogram of search times, owned by the caller
+
+    void bind_grid(void);
+    std::uint32_t cell_index(std::uint32_t y, std::uint32_t x) const { return y * this->stride + x; }
+    void begin_epoch(void);
+    bool is_reached(std::uint32_t cell) const { return this->visit_stamp[cell] >= this->epoch; }
+    bool is_closed(std::uint32_t cell) const { return this->visit_stamp[cell] == this->epoch + 1; }
+    bool is_open_cell(std::uint32_t cell) const { return this->cells[cell] != BLOCK_OBSTACLE && !is_closed(cell); }
+    void mark_reached(std::uint32_t cell) { this->visit_stamp[cell] = this->epoch; }
+    void mark_closed(std::uint32_t cell) { this->visit_stamp[cell] = this->epoch + 1; }
+    // Inside the grid and no obstacle; closed cells stay passable
+    bool is_passable(std::int64_t y, std::int64_t x) const { return (y >= 0) && (x >= 0) && (y < this->height) && (x < this->width) && (this->cells[cell_index(y, x)] != BLOCK_OBSTACLE); }
+    bool is_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_down_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_up_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_up_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_up_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_down_left_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    bool is_down_right_empty(std::uint32_t x, std::uint32_t y, bool mark_location);
+    std::uint32_t extract_path(std::uint32_t goal);
+    void expand_cell(std::uint32_t y, std::uint32_t x);
+    void relax_neighbour(std::uint32_t cell, std::uint32_t neighbour, double distance);
+    double heuristic(std::uint32_t cell);
+    double octile_bound(std::uint32_t dx, std::uint32_t dy) const;
+    bool jump_costs_supported(void) const;
+    void relax_astar_neighbour(std::uint32_t cell, std::uint32_t neighbour, double distance);
+    std::uint32_t random_search(void);
+    std::uint32_t bfs_search(void);
+    std::uint32_t dfs_search(void);
+    std::uint32_t dijkstra_search(void);
+    std::uint32_t astar_search(void);
+    double octile_distance(std::uint32_t from, std::uint32_t to);
+    bool has_forced_neighbour(std::int64_t y, std::int64_t x, int dy, int dx);
+    std::uint32_t jump_from_table(std::int64_t y, std::int64_t x, int dy, int dx);
+    std::uint32_t jump(std::int64_t y, std::int64_t x, int dy, int dx);
+    void jump_and_relax(std::uint32_t cell, int dy, int dx);
+    std::uint32_t extract_jump_path(std::uint32_t goal);
+    std::uint32_t jps_search(bool use_jump_table);
+    void reserve_backward(void);
+    std::uint32_t extract_bidirectional_path(std::uint32_t forward_end, std::uint32_t backward_start);
+    std::uint32_t bidirectional_bfs_search(void);
+    std::uint32_t bidirectional_dijkstra_search(void);
+    bool is_four_connected(void) const;
+    bool is_unreachable(void);
+    bool can_use_goal_field(void) const;
+    std::uint32_t goal_field_search(void);
+    bool can_use_landmarks(void) const;
+    std::size_t workspace_bytes(void) const;
+
+public:
+    explicit StartSearch(const GridMap &map);
+    StartSearch(const GridMap &map, std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x);
+    void set_endpoints(std::uint32_t start_position_y, std::uint32_t start_position_x, std::uint32_t end_position_y, std::uint32_t end_position_x);
+    std::uint32_t initiate_search(const std::string &search_type, SearchObserver *observer = nullptr);
+    void set_move_costs(MoveCosts move_costs);
+    void set_astar_config(AStarConfig astar_config);
+    void prepare_jump_table(void);
+    void set_component_index(const ComponentIndex *component_index);
+    void clear_component_indexes(void);
+    void set_goal_field_cache(GoalFieldCache *goal_field_cache);
+    void set_landmark_table(const LandmarkTable *landmark_table);
+    void set_latency_histogram(LatencyHistogram *latency_histogram);
+    const GridPath &get_path(void) const;
+    const SearchStats &get_stats(void) const;
+};
+
+#endif // PLANNER_START_SEARCH_HPP
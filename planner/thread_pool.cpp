@@ -0,0 +1,195 @@
+/**
+ * @file thread_pool.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Fixed pool of worker threads running index loops with work stealing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "thread_pool.hpp"
+
+/**
+ * @brief Start the worker threads
+ *
+ * @param thread_count Workers including the calling thread, 0 -> one per hardware thread
+ */
+ThreadPool::ThreadPool(std::uint32_t thread_count)
+{
+    if (thread_count == 0)
+        thread_count = std::thread::hardware_concurrency();
+    if (thread_count == 0)
+        thread_count = 1;
+
+    this->thread_count = thread_count;
+    this->ranges.reset(new WorkRange[thread_count]);
+    this->job = nullptr;
+    this->generation = 0;
+    this->running = 0;
+    this->stopping = false;
+
+    for (std::uint32_t worker = 1; worker < thread_count; worker++)
+        this->threads.emplace_back(&ThreadPool::thread_main, this, worker);
+}
+
+/**
+ * @brief Stop and join the worker threads
+ */
+ThreadPool::~ThreadPool(void)
+{
+    {
+        std::lock_guard<std::mutex> guard(this->job_lock);
+        this->stopping = true;
+    }
+    this->job_ready.notify_all();
+    for (std::thread &thread : this->threads)
+        thread.join();
+}
+
+/**
+ * @brief Take the next index from the front of the worker's own range
+ *
+ * @param worker
+ * @param index Set to the index taken
+ * @return true if the range was not empty
+ */
+bool ThreadPool::pop_local(std::uint32_t worker, std::size_t &index)
+{
+    WorkRange &range = this->ranges[worker];
+    std::lock_guard<std::mutex> guard(range.lock);
+    if (range.begin == range.end)
+        return false;
+    index = range.begin++;
+    return true;
+}
+
+/**
+ * @brief Move the back half of another worker's range into the worker's own, empty, range
+ *
+ * Victims are tried in order starting after the thief, and only one lock is held at a time.
+ *
+ * @param worker Thief
+ * @return true if anything was stolen
+ */
+bool ThreadPool::steal(std::uint32_t worker)
+{
+    for (std::uint32_t offset = 1; offset < this->thread_count; offset++)
+    {
+        WorkRange &victim = this->ranges[(worker + offset) % this->thread_count];
+        std::size_t begin, end;
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            std::size_t remaining = victim.end - victim.begin;
+            if (remaining == 0)
+                continue;
+            end = victim.end;
+            begin = end - (remaining + 1) / 2;
+            victim.end = begin;
+        }
+
+        WorkRange &own = this->ranges[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        own.begin = begin;
+        own.end = end;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Run the current job until no worker has indices left
+ *
+ * @param worker
+ */
+void ThreadPool::work(std::uint32_t worker)
+{
+    std::size_t index;
+    while (true)
+    {
+        if (pop_local(worker, index))
+        {
+            try
+            {
+                (*this->job)(worker, index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard(this->job_lock);
+                if (!this->failure)
+                    this->failure = std::current_exception();
+            }
+        }
+        else if (!steal(worker))
+            break;
+    }
+}
+
+/**
+ * @brief Body of a pool thread: wait for a job, work on it, report back
+ *
+ * @param worker
+ */
+void ThreadPool::thread_main(std::uint32_t worker)
+{
+    std::uint64_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(this->job_lock);
+            this->job_ready.wait(guard, [&]
+                                 { return this->stopping || this->generation != seen; });
+            if (this->stopping)
+                return;
+            seen = this->generation;
+        }
+
+        work(worker);
+
+        std::lock_guard<std::mutex> guard(this->job_lock);
+        if (--this->running == 0)
+            this->job_done.notify_one();
+    }
+}
+
+/**
+ * @brief Call body(worker, index) for every index in [0, count) and wait for all of them
+ *
+ * body runs concurrently on different indices; worker (0 .. size()-1) identifies the calling
+ * worker, so per-worker scratch can be indexed by it without locks. Not reentrant: body must
+ * not call parallel_for on the same pool.
+ *
+ * @param count Number of indices
+ * @param body Loop body
+ * @throw Rethrows the first exception thrown by body, after every index has been processed
+ */
+void ThreadPool::parallel_for(std::size_t count, const Job &body)
+{
+    if (count == 0)
+        return;
+
+    for (std::uint32_t worker = 0; worker < this->thread_count; worker++)
+    {
+        std::lock_guard<std::mutex> guard(this->ranges[worker].lock);
+        this->ranges[worker].begin = count * worker / this->thread_count;
+        this->ranges[worker].end = count * (worker + 1) / this->thread_count;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(this->job_lock);
+        this->job = &body;
+        this->failure = nullptr;
+        this->running = this->thread_count - 1;
+        this->generation++;
+    }
+    this->job_ready.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> guard(this->job_lock);
+    this->job_done.wait(guard, [&]
+                        { return this->running == 0; });
+    this->job = nullptr;
+    if (this->failure)
+        std::rethrow_exception(this->failure);
+}
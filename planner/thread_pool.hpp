@@ -0,0 +1,96 @@
+/**
+ * @file thread_pool.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Fixed pool of worker threads running index loops with work stealing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_THREAD_POOL_HPP
+#define PLANNER_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/* ---------------------------- THREAD POOL CLASS --------------------------- */
+/**
+ * @brief Worker threads that split index loops among themselves and steal from each other
+ *
+ * parallel_for() hands every worker an equal slice of the index range. A worker takes indices
+ * from the front of its own slice; once the slice is empty it steals the back half of the
+ * busiest-looking victim, so uneven items (a long search next to a trivial one) still keep
+ * every core busy. The calling thread works as worker 0, so a pool of one thread runs inline.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Non-owning reference to a loop body, so handing a lambda to parallel_for never allocates
+     *
+     * Only valid while the referenced callable lives; parallel_for() returns before the caller's
+     * lambda goes out of scope, which is the only way the pool uses it.
+     */
+    class Job
+    {
+        const void *body;
+        void (*call)(const void *body, std::uint32_t worker, std::size_t index);
+
+    public:
+        template <typename Body, typename = std::enable_if_t<!std::is_same<std::decay_t<Body>, Job>::value>>
+        Job(const Body &body)
+            : body(&body),
+              call([](const void *body, std::uint32_t worker, std::size_t index)
+                   { (*static_cast<const Body *>(body))(worker, index); })
+        {
+        }
+
+        void operator()(std::uint32_t worker, std::size_t index) const { call(body, worker, index); }
+    };
+
+private:
+    /**
+     * @brief Indices [begin, end) still owned by one worker, on its own cache line
+     */
+    struct alignas(64) WorkRange
+    {
+        std::mutex lock;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    std::vector<std::thread> threads;            // Workers 1 .. thread_count-1
+    std::unique_ptr<WorkRange[]> ranges;         // One range per worker, worker 0 included
+    std::uint32_t thread_count;                  // Workers including the calling thread
+    std::mutex job_lock;                         // Guards the fields below
+    std::condition_variable job_ready, job_done;
+    const Job *job;                              // Loop body of the running parallel_for
+    std::uint64_t generation;                    // Bumped for every parallel_for
+    std::uint32_t running;                       // Pool threads still working on the current job
+    bool stopping;
+    std::exception_ptr failure;                  // First exception thrown by the loop body
+
+    bool pop_local(std::uint32_t worker, std::size_t &index);
+    bool steal(std::uint32_t worker);
+    void work(std::uint32_t worker);
+    void thread_main(std::uint32_t worker);
+
+public:
+    explicit ThreadPool(std::uint32_t thread_count = 0);
+    ~ThreadPool(void);
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    std::uint32_t size(void) const { return thread_count; }
+    void parallel_for(std::size_t count, const Job &body);
+};
+
+#endif // PLANNER_THREAD_POOL_HPP
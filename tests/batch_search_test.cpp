@@ -0,0 +1,57 @@
+/**
+ * @file batch_search_test.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Batches report unreachable queries through their results only
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "../planner/batch_search.hpp"
+#include "../planner/common.hpp"
+#include "test_check.hpp"
+
+/**
+ * @brief Half the queries cross a full wall; they fail with steps 0 and print nothing
+ */
+static void test_unreachable_queries(void)
+{
+    GridMap map(32, 32);
+    for (std::uint32_t y = 0; y < 32; y++)
+        map.at(y, 16) = BLOCK_OBSTACLE;
+    map.mark_modified();
+
+    std::vector<PathQuery> queries;
+    for (std::uint32_t y = 1; y <= 32; y++)
+    {
+        queries.push_back(PathQuery{y, 1, 33 - y, 16}); // Same side of the wall
+        queries.push_back(PathQuery{y, 1, 33 - y, 32}); // Across the wall
+    }
+
+    std::ostringstream captured;
+    std::streambuf *console = std::cout.rdbuf(captured.rdbuf());
+    BatchSearch batch(map, 4);
+    std::vector<PathResult> results = batch.run(queries, BFS_SEARCH);
+    std::cout.rdbuf(console);
+
+    CHECK(captured.str().empty());
+    for (std::size_t query = 0; query < queries.size(); query++)
+    {
+        if (query % 2 == 0)
+            CHECK(results[query].steps != 0 && results[query].path.size() == results[query].steps);
+        else
+            CHECK(results[query].steps == 0 && results[query].path.size() == 0);
+    }
+}
+
+int main(void)
+{
+    test_unreachable_queries();
+    return CHECK_RESULT();
+}
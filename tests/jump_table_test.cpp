@@ -0,0 +1,103 @@
+/**
+ * @file jump_table_test.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief The JPS+ jump table must follow a map that gets a new buffer or new walls
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "../planner/common.hpp"
+#include "../planner/map_file.hpp"
+#include "../planner/start_search.hpp"
+#include "test_check.hpp"
+
+#define TEST_SIZE 20
+#define TEST_MAP_FILE "jump_table_test.gmap"
+
+/**
+ * @brief Open map with a wall down column 10 that leaves only the bottom row free
+ */
+static GridMap walled_map(void)
+{
+    GridMap map(TEST_SIZE, TEST_SIZE);
+    for (std::uint32_t y = 0; y + 1 < TEST_SIZE; y++)
+        map.at(y, 10) = BLOCK_OBSTACLE;
+    map.mark_modified();
+    return map;
+}
+
+/**
+ * @brief JPS+ from the top-left to the top-right corner must match JPS on the current cells
+ */
+static void check_jps_plus(StartSearch &search, std::uint32_t expected_steps)
+{
+    std::uint32_t jps_steps = search.initiate_search(JPS_SEARCH);
+    CHECK(jps_steps == expected_steps);
+    CHECK(search.initiate_search(JPS_PLUS_SEARCH) == jps_steps);
+}
+
+/**
+ * @brief Wall edit through mark_modified() on a reused context
+ */
+static void test_wall_edit(void)
+{
+    GridMap map(TEST_SIZE, TEST_SIZE);
+    StartSearch search(map, 1, 1, 1, TEST_SIZE);
+    check_jps_plus(search, TEST_SIZE);
+
+    for (std::uint32_t y = 0; y + 1 < TEST_SIZE; y++)
+        map.at(y, 10) = BLOCK_OBSTACLE;
+    map.mark_modified();
+    check_jps_plus(search, 2 * TEST_SIZE - 1);
+}
+
+/**
+ * @brief adopt() of a same-sized buffer, then an explicit prepare_jump_table()
+ */
+static void test_adopt(void)
+{
+    GridMap map(TEST_SIZE, TEST_SIZE);
+    StartSearch search(map, 1, 1, 1, TEST_SIZE);
+    check_jps_plus(search, TEST_SIZE);
+
+    GridMap walled = walled_map();
+    std::shared_ptr<std::uint8_t> cells(new std::uint8_t[walled.cell_count()], std::default_delete<std::uint8_t[]>());
+    std::memcpy(cells.get(), walled.data(), walled.cell_count());
+    map.adopt(cells, TEST_SIZE, TEST_SIZE, TEST_SIZE);
+    search.prepare_jump_table();
+    CHECK(search.initiate_search(JPS_PLUS_SEARCH) == 2 * TEST_SIZE - 1);
+    check_jps_plus(search, 2 * TEST_SIZE - 1);
+}
+
+/**
+ * @brief load_map() of a same-sized file, then an explicit prepare_jump_table()
+ */
+static void test_load_map(void)
+{
+    save_map(walled_map(), TEST_MAP_FILE);
+    GridMap map(TEST_SIZE, TEST_SIZE);
+    StartSearch search(map, 1, 1, 1, TEST_SIZE);
+    check_jps_plus(search, TEST_SIZE);
+
+    load_map(TEST_MAP_FILE, map);
+    search.prepare_jump_table();
+    CHECK(search.initiate_search(JPS_PLUS_SEARCH) == 2 * TEST_SIZE - 1);
+    check_jps_plus(search, 2 * TEST_SIZE - 1);
+    std::remove(TEST_MAP_FILE);
+}
+
+int main(void)
+{
+    test_wall_edit();
+    test_adopt();
+    test_load_map();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,96 @@
+/**
+ * @file map_version_test.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Data derived from a map must go stale when another map is assigned over it
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstdlib>
+#include <utility>
+
+#include "../planner/common.hpp"
+#include "../planner/component_index.hpp"
+#include "../planner/start_search.hpp"
+#include "test_check.hpp"
+
+/**
+ * @brief 5x5 map, optionally with a wall across column 2 closing off the right half
+ *
+ * Both kinds of map take the same edits, so a per-map version counter would give them equal
+ * versions; that is what an assignment must not let derived data mistake for its own.
+ */
+static GridMap make_map(bool walled)
+{
+    GridMap map(5, 5);
+    if (walled)
+        for (std::uint32_t y = 0; y < 5; y++)
+            map.at(y, 2) = BLOCK_OBSTACLE;
+    map.mark_modified();
+    return map;
+}
+
+/**
+ * @brief An index built before an assignment must not reject a query the new cells answer
+ */
+static void test_index_after_assignment(bool move)
+{
+    GridMap map = make_map(true);
+    ComponentIndex components(4);
+    components.build(map);
+    StartSearch search(map, 1, 1, 1, 5);
+    search.set_component_index(&components);
+    CHECK(search.initiate_search(BFS_SEARCH) == 0);
+
+    GridMap open = make_map(false);
+    if (move)
+        map = std::move(open);
+    else
+        map = open;
+    CHECK(!components.is_current(map));
+    CHECK(search.initiate_search(BFS_SEARCH) == 5);
+}
+
+/**
+ * @brief A JPS+ table built before an assignment must be rebuilt for the new walls
+ */
+static void test_jump_table_after_assignment(void)
+{
+    GridMap map = make_map(false);
+    StartSearch search(map, 1, 1, 1, 5);
+    CHECK(search.initiate_search(JPS_PLUS_SEARCH) == 5);
+
+    GridMap walled(5, 5);
+    for (std::uint32_t y = 0; y < 4; y++)
+        walled.at(y, 2) = BLOCK_OBSTACLE;
+    walled.mark_modified();
+    map = walled;
+    std::uint32_t jps_steps = search.initiate_search(JPS_SEARCH);
+    CHECK(jps_steps == 9);
+    CHECK(search.initiate_search(JPS_PLUS_SEARCH) == jps_steps);
+}
+
+/**
+ * @brief A moved-from map must not keep the version of the cells it gave away
+ */
+static void test_moved_from_map(void)
+{
+    GridMap map = make_map(false);
+    ComponentIndex components(4);
+    components.build(map);
+    GridMap taken = std::move(map);
+    CHECK(map.get_width() == 0 && map.cell_count() == 0);
+    CHECK(!components.is_current(map));
+    CHECK(taken.get_width() == 5);
+}
+
+int main(void)
+{
+    test_index_after_assignment(false);
+    test_index_after_assignment(true);
+    test_jump_table_after_assignment();
+    test_moved_from_map();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file move_costs_test.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief A*, JPS and JPS+ must keep the Dijkstra path cost for any positive move costs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "../planner/common.hpp"
+#include "../planner/setup_grid.hpp"
+#include "../planner/start_search.hpp"
+#include "test_check.hpp"
+
+#define TEST_SIZE 64
+
+/**
+ * @brief Compare every heuristic search against Dijkstra on seeded queries
+ */
+static void test_costs(MoveCosts move_costs)
+{
+    GridMap map;
+    Setup_Grid(map, TEST_SIZE, TEST_SIZE, 20, 7).initialize_grid();
+    StartSearch search(map);
+    search.set_move_costs(move_costs);
+    const char *search_types[3] = {ASTAR_SEARCH, JPS_SEARCH, JPS_PLUS_SEARCH};
+
+    for (std::uint32_t query = 0; query < 40; query++)
+    {
+        std::uint32_t start_y = (query * 17) % TEST_SIZE, start_x = (query * 29) % TEST_SIZE;
+        std::uint32_t end_y = (query * 41 + 7) % TEST_SIZE, end_x = (query * 13 + 31) % TEST_SIZE;
+        if (map.at(start_y, start_x) == BLOCK_OBSTACLE || map.at(end_y, end_x) == BLOCK_OBSTACLE)
+            continue;
+        search.set_endpoints(start_y + 1, start_x + 1, end_y + 1, end_x + 1);
+        if (search.initiate_search(DIJKSTRA_SEARCH) == 0)
+            continue;
+        double cost = search.get_stats().path_cost;
+        for (const char *search_type : search_types)
+        {
+            CHECK(search.initiate_search(search_type) != 0);
+            CHECK(std::fabs(search.get_stats().path_cost - cost) <= 1e-9 * cost);
+        }
+    }
+}
+
+/**
+ * @brief Costs that are not positive are refused
+ */
+static void test_invalid_costs(void)
+{
+    GridMap map(4, 4);
+    StartSearch search(map);
+    bool thrown = false;
+    try
+    {
+        search.set_move_costs(MoveCosts{1.0, 0.0});
+    }
+    catch (const std::invalid_argument &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+int main(void)
+{
+    test_costs(MoveCosts());          // Octile
+    test_costs(MoveCosts{1.0, 1.0});  // Chebyshev
+    test_costs(MoveCosts{1.0, 2.0});  // Diagonal equal to two straight moves
+    test_costs(MoveCosts{1.0, 3.0});  // Diagonal dearer than two straight moves
+    test_costs(MoveCosts{1.0, 0.6});  // Diagonal cheaper than a straight move
+    test_invalid_costs();
+    return CHECK_RESULT();
+}
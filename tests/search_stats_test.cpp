@@ -0,0 +1,59 @@
+/**
+ * @file search_stats_test.cpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief bytes_allocated counts every allocation a search makes, goal fields and path included
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstdlib>
+
+#include "../planner/common.hpp"
+#include "../planner/goal_field_cache.hpp"
+#include "../planner/start_search.hpp"
+#include "test_check.hpp"
+
+/**
+ * @brief A longer path than any before grows the path buffer; a repeat query allocates nothing
+ */
+static void test_path_growth(void)
+{
+    GridMap map(64, 64);
+    StartSearch search(map, 1, 1, 1, 3);
+    search.initiate_search(BFS_SEARCH);
+
+    search.set_endpoints(1, 1, 64, 64);
+    CHECK(search.initiate_search(BFS_SEARCH) != 0);
+    CHECK(search.get_stats().bytes_allocated != 0);
+
+    CHECK(search.initiate_search(BFS_SEARCH) != 0);
+    CHECK(search.get_stats().bytes_allocated == 0);
+}
+
+/**
+ * @brief A cache miss reports the field it flooded; a hit on the same goal reports nothing
+ */
+static void test_goal_field_miss(void)
+{
+    GridMap map(64, 64);
+    GoalFieldCache cache(map);
+    StartSearch search(map, 1, 1, 64, 64);
+    search.initiate_search(BFS_SEARCH); // Size the search buffers and path first
+    search.set_goal_field_cache(&cache);
+
+    CHECK(search.initiate_search(BFS_SEARCH) != 0);
+    CHECK(search.get_stats().bytes_allocated >= map.cell_count() * (sizeof(double) + sizeof(std::uint32_t)));
+
+    search.set_endpoints(32, 1, 64, 64);
+    CHECK(search.initiate_search(BFS_SEARCH) != 0);
+    CHECK(search.get_stats().bytes_allocated == 0);
+}
+
+int main(void)
+{
+    test_path_growth();
+    test_goal_field_miss();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,39 @@
+/**
+ * @file test_check.hpp
+ * @author Parth Patel (parth.pmech@gmail.com)
+ * @brief Minimal check macro shared by the headless regression tests
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef PLANNER_TEST_CHECK_HPP
+#define PLANNER_TEST_CHECK_HPP
+
+#include <iostream>
+
+/**
+ * @brief Failed checks of the running test binary
+ */
+static int check_failures = 0;
+
+/**
+ * @brief Report a failed condition with its location and keep going
+ */
+#define CHECK(condition)                                                                       \
+    do                                                                                         \
+    {                                                                                          \
+        if (!(condition))                                                                      \
+        {                                                                                      \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition "\n"; \
+            check_failures++;                                                                  \
+        }                                                                                      \
+    } while (0)
+
+/**
+ * @brief Exit status of the test binary
+ */
+#define CHECK_RESULT() (check_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE)
+
+#endif // PLANNER_TEST_CHECK_HPP